@@ -3,6 +3,12 @@
 
 #include "auxiliary.hpp"
 
+/* Result of one frame of a frame-parallel analysis */
+struct analysis_frame {
+  std::string output;      // text appended to the analysis output file
+  std::vector<int> counts; // analysis-defined tallies, e.g. histogram bins
+};
+
 class AnalysisBase {
 private:
   std::string analysis_name_ = "unnamed";
@@ -54,6 +60,13 @@ protected:
   virtual void InitAnalysis() {}
   virtual void RunAnalysis() {}
   virtual void EndAnalysis() {}
+  /* Frame-parallel analyses split RunAnalysis into MapFrame, which computes a
+     frame from members alone and may run concurrently on copies of the
+     members, so it must not modify the analysis, and ReduceFrame, which
+     applies the result and is called in frame order. */
+  virtual void MapFrame(std::vector<T> &members, double time,
+                        analysis_frame &frame) {}
+  virtual void ReduceFrame(analysis_frame &frame) {}
 
 public:
   virtual void Init(std::vector<T> &members, species_parameters<S> &sparams) {
@@ -66,11 +79,25 @@ public:
     InitAnalysis();
     Logger::Info("Running %s analysis", GetAnalysisName().c_str());
   }
-  virtual void Run() {
-    time_ = 0.5 * params_->i_step * params_->delta;
+  virtual void Run() { RunAt(params_->i_step); }
+  /* Run on the frame of step i_step. Does not read params_->i_step, so
+     in-situ analyses can run off the simulation thread. */
+  void RunAt(int i_step) {
+    time_ = GetFrameTime(i_step);
     RunAnalysis();
     iteration_++;
   }
+  double GetFrameTime(int i_step) const { return 0.5 * i_step * params_->delta; }
+  virtual bool IsFrameParallel() { return false; }
+  /* Equivalent to Run on step i_step, split for frame-parallel processing */
+  void Map(std::vector<T> &members, int i_step, analysis_frame &frame) {
+    MapFrame(members, GetFrameTime(i_step), frame);
+  }
+  void Reduce(int i_step, analysis_frame &frame) {
+    time_ = GetFrameTime(i_step);
+    ReduceFrame(frame);
+    iteration_++;
+  }
   virtual void End() {
     EndAnalysis();
     AnalysisBase::End();
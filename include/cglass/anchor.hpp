@@ -14,6 +14,28 @@ struct bind_params {
   bool single_occupancy;
 };
 
+/* Total amount of objects with a given name available for binding */
+struct bind_amounts {
+  double length = 0;
+  double area = 0;
+  double free_length = 0; // objects without anchors
+  double free_area = 0;
+};
+
+/* Binding parameters of an object, looked up by its interned name ID. Names
+   interned after the ID table was built fall back to the name map. Returns
+   nullptr if the object name has no binding parameters. */
+inline bind_params *FindBindParams(std::map<std::string, bind_params> &by_name,
+                                   std::vector<bind_params *> const &by_id,
+                                   Object const *obj) {
+  int name_id = obj->GetNameID();
+  if (name_id < (int)by_id.size()) {
+    return by_id[name_id];
+  }
+  auto it = by_name.find(obj->GetName());
+  return (it == by_name.end() ? nullptr : &it->second);
+}
+
 /* Class for bound crosslink heads (called anchors). Tracks and updates its
    absolute position in space and relative position to its bound object. */
 class Anchor : public Object {
@@ -23,6 +45,7 @@ class Anchor : public Object {
   bool active_;
   bool plus_end_pausing_;
   bool minus_end_pausing_;
+  bool on_track_ = false; // moved by its mesh's motor track sweep this step
   crosslink_parameters *sparams_;
   int index_;
   int step_direction_;
@@ -46,6 +69,7 @@ class Anchor : public Object {
   double force_dep_vel_flag_;
   bool use_bind_file_;
   std::vector<std::map<std::string, bind_params> > *bind_param_map_ = nullptr;
+  std::vector<std::vector<bind_params *> > *bind_param_ids_ = nullptr;
 
   double input_tol = 1e-8; // Tolerance for comparing inputs to 0
 
@@ -63,6 +87,14 @@ class Anchor : public Object {
 
   double *obj_size_ = nullptr;
   double *bind_rate_ = nullptr;
+  // Changes to obj_size_ and bind_rate_, which are shared by all anchors,
+  // held until they can be applied in a fixed order
+  double obj_size_change_ = 0;
+  double bind_rate_change_ = 0;
+  // Spheres whose occupancy changed, passed on to occupancy_changes_ with the
+  // changes above
+  std::vector<Object *> *occupancy_changes_ = nullptr;
+  std::vector<Object *> changed_spheres_;
 
   int mesh_n_bonds_;
 
@@ -70,19 +102,27 @@ class Anchor : public Object {
   void UpdateAnchorPositionToObj();
   void Diffuse();
   void Walk();
+  void DiffuseAndWalk();
   bool CheckMesh();
   bool CalcRodLambda();
 
  public:
   Anchor(unsigned long seed);
   void Init(crosslink_parameters *sparams, int index);
-  void SetBindParamMap(std::vector<std::map<std::string, bind_params> >*);
+  void SetBindParamMap(std::vector<std::map<std::string, bind_params> >*,
+                       std::vector<std::vector<bind_params *> >*);
   bool IsBound();
   void UpdatePosition();
   void Activate();
   void Deactivate();
   void ApplyAnchorForces();
   void UpdateAnchorPositionToMesh();
+  Mesh *GetTrackMesh();
+  Composite *GetComp() { return comp_; }
+  void SetOnTrack(bool on_track) { on_track_ = on_track; }
+  bool IsOnTrack() const { return on_track_; }
+  void UpdateAnchorPositionToTrack(int &i_bond);
+  void UpdatePositionOnTrack();
   void SetDiffusion();
   void AttachObjRandom(Object *o);
   void AttachObjLambda(Object *o, double lambda);
@@ -95,15 +135,18 @@ class Anchor : public Object {
   void SetBound();
   void Unbind();
   void AddBackBindRate();
+  void RemoveBindRate();
+  void FlushBindRate();
   int const GetBoundOID();
   void Draw(std::vector<graph_struct *> &graph_array);
-  void AddNeighbor(Object *neighbor);
+  void AddNeighbor(const Rod *neighbor);
+  void AddNeighbor(const Sphere *neighbor);
   void ClearNeighbors();
   const Object *const *GetNeighborListMem();
   const std::vector<const Rod*>& GetNeighborListMemRods();
   const std::vector<const Sphere*>& GetNeighborListMemSpheres();
-  void WriteSpec(std::fstream &ospec);
-  void ReadSpec(std::fstream &ispec);
+  void WriteSpec(FrameBuffer &ospec);
+  void ReadSpec(FrameReader &ispec);
   void SetRatesFromBindFile(const std::string &name);
   void BindToPosition(double *bind_pos);
   void SetStatic(bool static_flag);
@@ -128,6 +171,7 @@ class Anchor : public Object {
   void SetObjSize(double* obj_size);
   const double* const GetBindRate();
   void SetBindRate(double* bind_rate);
+  void SetOccupancyChanges(std::vector<Object *> *occupancy_changes);
   double CalcSingleBindRate();
   bool InducesCatastrophe();
   bool AttachedToFilament();
@@ -135,7 +179,8 @@ class Anchor : public Object {
 
   // Convert binary data to text. Static to avoid needing to instantiate
   // species members in conversion mode.
-  static void ConvertSpec(std::fstream &ispec, std::fstream &otext);
+  static void ConvertSpec(FrameReader &ispec, std::fstream &otext);
+  static void ExportSpec(FrameReader &ispec, ColumnFrame &columns);
   static void WriteSpecTextHeader(std::fstream &otext);
 };
 
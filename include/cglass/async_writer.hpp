@@ -0,0 +1,58 @@
+#ifndef _CGLASS_ASYNC_WRITER_H_
+#define _CGLASS_ASYNC_WRITER_H_
+
+#include "frame_buffer.hpp"
+#include "logger.hpp"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/* Background writer for output frames. The simulation serializes a frame into
+   a FrameBuffer, which is swapped into a pooled buffer and queued, so the
+   next steps can proceed while a dedicated thread writes the frame to file.
+   Frames are written in submission order. When max_pending frames are already
+   queued, Submit blocks until the writer catches up. Write failures are
+   recorded by the writer thread and raised on the simulation thread by the
+   next call to Submit, Drain or Stop. */
+class AsyncWriter {
+private:
+  struct frame_job {
+    std::fstream *out = nullptr;
+    std::string file_name; // used if out is null: replaced atomically
+    FrameBuffer frame;
+  };
+  std::deque<frame_job> queue_;
+  std::vector<FrameBuffer> pool_; // drained buffers, kept for their capacity
+  std::mutex mtx_;
+  std::condition_variable queue_cv_;
+  std::condition_variable space_cv_;
+  std::thread thread_;
+  int max_pending_ = 2;
+  bool running_ = false;
+  bool busy_ = false;
+  std::string error_; // first write failure, empty if none
+  void Run();
+  void RaiseError(std::unique_lock<std::mutex> &lk);
+  void Enqueue(FrameBuffer &frame, std::fstream *out,
+               std::string const &file_name);
+
+public:
+  AsyncWriter() {}
+  ~AsyncWriter() { Stop(); }
+  AsyncWriter(const AsyncWriter &) = delete;
+  AsyncWriter &operator=(const AsyncWriter &) = delete;
+  void Start(int max_pending);
+  bool IsRunning() const { return running_; }
+  /* Queue frame for writing to out. frame is left empty on return. */
+  void Submit(FrameBuffer &frame, std::fstream &out);
+  /* Queue frame to replace the contents of the file file_name */
+  void Submit(FrameBuffer &frame, std::string const &file_name);
+  /* Block until every queued frame has been written */
+  void Drain();
+  /* Drain and join the writer thread */
+  void Stop();
+};
+
+#endif
@@ -66,12 +66,12 @@ public:
     }
     return clen;
   }
-  void WritePosit(std::fstream &oposit);
-  void ReadPosit(std::fstream &iposit);
-  void WriteSpec(std::fstream &ospec);
-  void ReadSpec(std::fstream &ispec);
-  void WriteCheckpoint(std::fstream &ocheck);
-  void ReadCheckpoint(std::fstream &icheck);
+  void WritePosit(FrameBuffer &oposit);
+  void ReadPosit(FrameReader &iposit);
+  void WriteSpec(FrameBuffer &ospec);
+  void ReadSpec(FrameReader &ispec);
+  void WriteCheckpoint(FrameBuffer &ocheck);
+  void ReadCheckpoint(FrameReader &icheck);
   void ScalePosition();
   double const GetVolume();
 };
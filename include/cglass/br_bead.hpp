@@ -36,12 +36,13 @@ public:
   virtual int GetCount();
   virtual void Draw(std::vector<graph_struct *> &graph_array);
   virtual void ZeroForce();
-  virtual void ReadSpec(std::fstream &ip);
-  virtual void WriteSpec(std::fstream &op);
+  virtual void ReadSpec(FrameReader &ip);
+  virtual void WriteSpec(FrameBuffer &op);
 
   // Convert binary data to text. Static to avoid needing to istantiate
   // species members.
-  static void ConvertSpec(std::fstream &ispec, std::fstream &otext);
+  static void ConvertSpec(FrameReader &ispec, std::fstream &otext);
+  static void ExportSpec(FrameReader &ispec, ColumnFrame &columns);
   static void WriteSpecTextHeader(std::fstream &otext);
 };
 #endif // _CGLASS_BR_BEAD_H_
@@ -21,6 +21,7 @@ private:
 public:
   Cell();
   void AddObj(Object &obj);
+  void RemoveObjs(std::vector<Object *> const &objs);
   void PopBack();
   void AssignIndex(const int x, const int y, const int z);
   bool IsInteractingPair(species_id si, species_id sj) const;
@@ -29,6 +30,7 @@ public:
   std::string Report() const;
   const std::vector<Cell *> &GetCellNeighbors() const;
   void PairSingleObject(Object &obj, std::vector<Interaction> &pair_list) const;
+  void PairNewObject(Object &obj, std::vector<Interaction> &pair_list) const;
   void ClearObjs();
   void ClearNeighbors();
 };
@@ -30,6 +30,8 @@ public:
   void ResetNeighbors();
   void AssignObjectsCells(std::vector<Object *> &objs);
   void PairSingleObject(Object &obj, std::vector<Interaction> &pair_list);
+  void AddObject(Object &obj, std::vector<Interaction> &pair_list);
+  void RemoveObjects(std::vector<Object *> const &objs);
   void ClearCellObjects();
   void Clear();
   void BuildCellList();
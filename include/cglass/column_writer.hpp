@@ -0,0 +1,87 @@
+#ifndef _CGLASS_COLUMN_WRITER_H_
+#define _CGLASS_COLUMN_WRITER_H_
+
+#include "logger.hpp"
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+/* Fields of the members of one spec frame, gathered column by column by the
+   static ExportSpec functions of the member type. Fields of nested members,
+   such as filament sites or crosslink anchors, go to columns prefixed with
+   the name of their group, and the number of nested members of each member
+   to the column <group>_offsets. */
+class ColumnFrame {
+public:
+  struct column {
+    std::string name;
+    std::string descr; // numpy type descriptor
+    int width;         // values per row
+    bool offsets;      // holds counts, written as running offsets
+    int64_t rows;
+    std::vector<char> data;
+  };
+
+private:
+  std::vector<column> columns_;
+  std::string prefix_;
+  std::vector<size_t> prefix_sizes_;
+  size_t next_ = 0; // members add their fields in the same order
+  column &Get(std::string const &name, const char *descr, int width,
+              bool offsets);
+  void Append(std::string const &name, const char *descr, const void *values,
+              size_t size, int width, bool offsets);
+
+public:
+  void Add(std::string const &name, const double *values, int width = 1);
+  void Add(std::string const &name, const int *values, int width = 1);
+  void Add(std::string const &name, const bool *values, int width = 1);
+  void Add(std::string const &name, const unsigned char *values,
+           int width = 1);
+  /* Record the number of nested members of group the current member has */
+  void AddCount(std::string const &group, int count);
+  void BeginGroup(std::string const &group);
+  void EndGroup();
+  /* Empty the columns, keeping their storage for the next frame */
+  void Clear();
+  std::vector<column> const &Columns() const { return columns_; }
+};
+
+/* Writes the frames of a species to a directory with one .npy file per
+   column, plus step.npy and time.npy with the step and time of each frame
+   and frame_offsets.npy with the offset of the first member of each frame
+   (and the total member count as its last entry). Offsets columns likewise
+   start at zero and end with the total count, so the nested members of
+   member i are rows offsets[i] to offsets[i + 1] of the group's columns.
+   Headers are written with room for the final shapes, which are filled in on
+   Close, so the files can be memory mapped with numpy.load(mmap_mode='r'). */
+class ColumnWriter {
+private:
+  struct column_file {
+    std::string descr;
+    int width;
+    bool offsets;
+    int64_t rows = 0;
+    int64_t total = 0; // running offset
+    std::fstream file;
+  };
+  std::string dir_;
+  std::map<std::string, std::unique_ptr<column_file> > files_;
+  column_file *GetFile(std::string const &name, std::string const &descr,
+                       int width, bool offsets);
+  void WriteHeader(column_file &col);
+  void Write(column_file &col, const char *data, size_t size, int64_t rows);
+  void WriteOffsets(column_file &col, const int64_t *counts, int64_t rows);
+
+public:
+  ~ColumnWriter() { Close(); }
+  /* Create dir if needed. Returns false if it cannot be used. */
+  bool Open(std::string const &dir);
+  void Append(ColumnFrame const &frame, int step, double time, int n_members);
+  void Close();
+};
+
+#endif
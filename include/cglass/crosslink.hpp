@@ -33,14 +33,31 @@ private:
   double polar_affinity_;
   bool use_bind_file_;
   int bound_anchor_ = 0; // Index of anchor that is bound if Singly
-  std::map<Sphere *, std::pair<std::vector<double>, std::vector<Anchor*> > > *bound_curr_ = nullptr;
   std::vector<std::map<std::string, bind_params> > *bind_param_map_ = nullptr;
+  std::vector<std::vector<bind_params *> > *bind_param_ids_ = nullptr;
   double *bind_rate_ = nullptr;
+  // Sphere the unbound head chose to bind during the parallel KMC step, which
+  // is resolved against competing crosslinks before it is committed
+  Sphere *sphere_proposal_ = nullptr;
+  double sphere_proposal_prob_ = 0;
+  // With event-driven kinetics, the probability each reaction channel may
+  // still integrate before it fires. Negative until drawn for the current
+  // state. Channels are (unbind, bind) when singly bound and the unbinding
+  // of each head when doubly bound.
+  bool event_driven_ = false;
+  double event_clock_[2] = {-1, -1};
+  // Set once a binding probability exceeded BindProbBound, after which it is
+  // evaluated every step
+  bool bind_bound_exceeded_ = false;
   std::vector<Anchor> anchors_;
   void CalculateTetherForces();
   void CalculateBinding();
   void SinglyKMC();
   void DoublyKMC();
+  int ChooseEvent(double prob0, double prob1);
+  void UnbindSingly();
+  double BindProbBound(std::vector<double> const &bind_factors,
+                       int n_neighbors_sphere);
   void UpdateAnchorsToMesh();
   void UpdateAnchorPositions();
   void UpdateXlinkState();
@@ -49,15 +66,24 @@ private:
 public:
   Crosslink(unsigned long seed);
   void Init(crosslink_parameters *sparams);
-  void InitInteractionEnvironment(LookupTable *lut, Tracker *tracker, 
-                                  std::map<Sphere *, std::pair<std::vector<double>, 
-                                  std::vector<Anchor*> > > *bound_curr);
-  void SetBindParamMap(std::vector<std::map<std::string, bind_params> > 
-                       *bind_param_map);
+  void InitInteractionEnvironment(LookupTable *lut, Tracker *tracker);
+  void SetBindParamMap(std::vector<std::map<std::string, bind_params> > *,
+                       std::vector<std::vector<bind_params *> > *);
   void AttachObjRandom(std::pair<Object *, int> obj_index);
+  Sphere *GetSphereProposal() const { return sphere_proposal_; }
+  const double GetSphereProposalProb() const { return sphere_proposal_prob_; }
+  void CommitSphereProposal();
+  double const *GetEventClocks() const { return event_clock_; }
+  void SetEventClocks(double const *clocks) {
+    std::copy(clocks, clocks + 2, event_clock_);
+  }
+  void ResetEventClocks();
+  void ClearSphereProposal() { sphere_proposal_ = nullptr; }
+  void FlushBindRates();
   void UpdateCrosslinkForces();
   void UpdateCrosslinkPositions();
   void GetAnchors(std::vector<Object *> &ixors);
+  Anchor *GetAnchor(int i) { return &anchors_[i]; }
   void GetInteractors(std::vector<Object *> &ixors);
   void Draw(std::vector<graph_struct *> &graph_array);
   void SetDoubly();
@@ -68,10 +94,10 @@ public:
   const bool IsUnbound() const;
   const bool IsSingly() const;
   void UpdatePosition();
-  void WriteSpec(std::fstream &ospec);
-  void WriteCheckpoint(std::fstream &ocheck);
-  void ReadSpec(std::fstream &ispec);
-  void ReadCheckpoint(std::fstream &icheck);
+  void WriteSpec(FrameBuffer &ospec);
+  void WriteCheckpoint(FrameBuffer &ocheck);
+  void ReadSpec(FrameReader &ispec);
+  void ReadCheckpoint(FrameReader &icheck);
   void ClearNeighbors();
   void ZeroForce();
   void ApplyTetherForces();
@@ -81,6 +107,7 @@ public:
   const int GetNNeighbors() const;
   void SetObjSize(double *obj_size);
   void SetBindRate(double *bind_rate);
+  void SetOccupancyChanges(std::vector<Object *> *occupancy_changes);
   void SetSpheresBoundCurr(double *obj_size);
   const double* const GetObjSize();
   const double *const GetPosition();
@@ -88,7 +115,8 @@ public:
 
   // Convert binary data to text. Static to avoid needing to istantiate
   // species members.
-  static void ConvertSpec(std::fstream &ispec, std::fstream &otext);
+  static void ConvertSpec(FrameReader &ispec, std::fstream &otext);
+  static void ExportSpec(FrameReader &ispec, ColumnFrame &columns);
   static void WriteSpecTextHeader(std::fstream &otext);
 };
 
@@ -11,18 +11,33 @@ class CrosslinkOutputManager : public OutputManagerBase<CrosslinkSpecies> {
   void InitThermo(std::string fname) {}
 };
 
+/* Candidate binding target of an anchor, gathered from the pair list. Exactly
+   one of rod and sphere is set. */
+struct anchor_neighbor {
+  Anchor *anchor;
+  const Rod *rod;
+  const Sphere *sphere;
+  int target_oid;
+};
+
 class CrosslinkManager {
  private:
   system_parameters *params_;
   CrosslinkOutputManager output_mgr_;
   double obj_size_;
+  bool obj_size_update_ = true;
+  // Amount of objects available for binding, indexed by object name ID
+  std::vector<bind_amounts> obj_amounts_;
+  // Spheres whose occupancy changed, for updating bind weights of all species
+  std::vector<Object *> occupancy_changes_;
   double rcutoff_ = 0;  // Cutoff for binding any crosslink and bond
   bool update_;
   std::vector<CrosslinkSpecies *> xlink_species_;
   std::vector<Object *> *objs_;
-  std::map<Sphere *, std::pair<std::vector<double>, std::vector<Anchor*> > > bound_curr_;
   SpaceBase *space_;
   Tracker *tracker_ = nullptr;
+  // Reused between steps to avoid reallocating the neighbor records
+  std::vector<anchor_neighbor> anchor_neighbors_;
 
  public:
   void Init(system_parameters *params, SpaceBase *space, Tracker *tracker,
@@ -30,15 +45,18 @@ class CrosslinkManager {
   void GetInteractors(std::vector<Object *> &ixors);
   void UpdateCrosslinks();
   void UpdateObjsSize();
+  void FlagObjsSizeUpdate() { obj_size_update_ = true; }
   bool CheckUpdate();
   void Clear();
   void Draw(std::vector<graph_struct *> &graph_array);
-  void AddNeighborToAnchor(Object *anchor, Object *neighbor);
+  void BuildAnchorNeighbors(std::vector<Interaction> const &pairs);
   void WriteOutputs();
-  void Knockout();
   void InitOutputs(bool reading_inputs = false,
                    run_options *run_opts = nullptr);
   void GetAnchorInteractors(std::vector<Object *> &ixors);
+  bool HasFrameIndex() { return output_mgr_.HasFrameIndex(); }
+  void SetSeekFrames(bool seek) { output_mgr_.SetSeekFrames(seek); }
+  int GetInputFrameInterval() { return output_mgr_.GetInputFrameInterval(); }
   void InitSpecies(sid_label &slab, ParamsParser &parser, unsigned long seed);
   void LoadCrosslinksFromCheckpoints(std::string run_name,
                                      std::string checkpoint_run_name);
@@ -47,6 +65,7 @@ class CrosslinkManager {
   const double GetDrMax();
   void ReadInputs();
   void Convert();
+  void ExportColumns();
   void InsertCrosslinks();
   void InsertAttachedCrosslinks();
   const double GetRCutoff() const {
@@ -2,16 +2,27 @@
 #define _CGLASS_CROSSLINK_SPECIES_H_
 
 #include "crosslink.hpp"
+#include "fenwick_tree.hpp"
 #include "species.hpp"
 #include <KMC/kmc.hpp>
+#include <unordered_map>
 
 typedef std::vector<std::pair<std::vector<Crosslink>::iterator,
                               std::vector<Crosslink>::iterator>>
     xlink_chunk_vector;
 typedef std::vector<Crosslink>::iterator xlink_iterator;
 
+/* A computed binding lookup table and the binding volume of its filler */
+struct lut_cache_entry {
+  LookupTable lut;
+  double bind_volume;
+};
+
 class CrosslinkSpecies : public Species<Crosslink, species_id::crosslink> {
 private:
+  /* Lookup tables already computed in this process, keyed by LUT inputs, so
+     repeated runs and analyses with the same springs skip the integration */
+  static std::map<std::string, lut_cache_entry> _lut_cache_;
   bool *update_;
   std::string checkpoint_file_;
   double *obj_size_; // Total area/length of all the objects in the system
@@ -27,44 +38,102 @@ private:
   Tracker *tracker_ = nullptr;
   LookupTable lut_;
   std::vector<Object *> *objs_;
-  std::map<Sphere *, std::pair<std::vector<double>, std::vector<Anchor*> > > *bound_curr_;
   
   // use a map of species names to binding parameters to
   // store binding parameters for specific species for each anchor
   std::vector<std::map<std::string, bind_params> > bind_param_map_;
+  // The same binding parameters indexed by interned object name ID
+  std::vector<std::vector<bind_params *> > bind_param_ids_;
 
   // A default binding parameter list to initialize bind_param_map to
   std::vector<bind_params> default_bind_params_;
 
   // Binding factor- k_on_s * bind_site_density * object_amount
   double bind_rate_;
+  // Expected number of bindings from solution left before the next one fires,
+  // used with event-driven kinetics. Negative until first drawn.
+  double free_bind_clock_ = -1;
+
+  /* Bind weights of each (anchor index, object) pair for drawing binding
+     targets. Kept between steps and updated as objects change size or
+     occupancy, and rebuilt when objects are added, removed or reordered. */
+  FenwickTree bind_weights_;
+  std::unordered_map<int, int> bind_weight_index_; // object OID -> index
+  bool bind_weights_stale_ = true;
+  // Spheres whose occupancy changed this step, shared by all crosslink
+  // species, and the number already applied to bind_weights_
+  std::vector<Object *> *occupancy_changes_ = nullptr;
+  size_t n_occupancy_synced_ = 0;
+
+  /* Anchors moving along meshes, grouped by mesh and sorted by mesh lambda,
+     and the tracks swept by each thread. Anchors are owned by crosslinks, so
+     the tracks are kept until crosslinks bind, unbind or move in members_. */
+  std::vector<Anchor *> motor_tracks_;
+  std::vector<int> motor_track_offsets_; // start of each track, then the end
+  std::vector<std::pair<int, int>> motor_track_chunks_;
+  bool motor_tracks_stale_ = true;
+
+  /* Anchors of doubly-bound crosslinks grouped by the composite they are
+     bound to, in crosslink order within each group, and the groups handled by
+     each thread. Kept until crosslinks bind, unbind or move in members_. */
+  std::vector<std::pair<int, Anchor *>> tether_anchors_;
+  std::vector<int> tether_offsets_;
+  std::vector<std::pair<int, int>> tether_chunks_;
+  bool tether_groups_stale_ = true;
 
   void InitializeBindParams();
+  void UpdateBindParamIDs();
   LUTFiller *MakeLUTFiller();
+  std::string GetLUTKey() const;
+  void InitLookupTable();
   void CalculateBindingFree();
+  int DrawFreeBindNumber(double expected_bind_n);
+  void WriteCheckpointState(FrameBuffer &ocheck);
+  void ReadCheckpointState(FrameReader &icheck);
   void BindCrosslink();
   void UpdateBoundCrosslinks();
   void UpdateBoundCrosslinkForces();
   void UpdateBoundCrosslinkPositions();
+  void CommitSphereBindings();
+  void BuildMotorTracks();
+  void UpdateMotorTracks(bool walk);
+  void ClearMotorTracks();
+  void BuildTetherGroups();
   void ApplyCrosslinkTetherForces();
   std::pair<Object*, int> GetRandomObject();
+  double CalcBindWeight(Object *obj, int anchor_index, bool occupied);
+  void BuildBindWeights();
+  void UpdateObjBindWeights(Object *obj, int i);
+  /* Crosslinks were added, removed or replaced, so motor tracks and tether
+     groups need to be rebuilt */
+  void SetMembersChanged() {
+    motor_tracks_stale_ = true;
+    tether_groups_stale_ = true;
+  }
+  /* Crosslinks bound or unbound, so interactors need to be updated too */
+  void SetBindingChanged() {
+    *update_ = true;
+    SetMembersChanged();
+  }
 
 public:
   CrosslinkSpecies(unsigned long seed);
   void Init(std::string spec_name, ParamsParser &parser);
   void LoadBindingSpecies();
-  void InitInteractionEnvironment(std::vector<Object *> *objs, double *obj_size, Tracker *tracker, bool *update,
-                                  std::map<Sphere *, std::pair<std::vector<double>, 
-                                  std::vector<Anchor*> > > *bound_curr);
+  void InitInteractionEnvironment(std::vector<Object *> *objs, double *obj_size,
+                                  std::vector<Object *> *occupancy_changes,
+                                  Tracker *tracker, bool *update);
   void TestKMCStepSize();
   void GetInteractors(std::vector<Object *> &ixors);
   void UpdatePositions();
-  void UpdateBindRate();
+  void UpdateBindRate(std::vector<bind_amounts> const &amounts);
+  void RefreshBindWeights();
+  void SyncBindWeights();
+  void ResetOccupancySync() { n_occupancy_synced_ = 0; }
   void CleanUp();
   void ClearNeighbors();
   void Draw(std::vector<graph_struct *> &graph_array);
   void BindCrosslinkObj(Object *obj);
-  void AddNeighborToAnchor(Object *anchor, Object *neighbor);
   void AddMember();
   void InsertAttachedCrosslinksSpecies();
   void GetAnchorInteractors(std::vector<Object *> &ixors);
@@ -68,6 +68,9 @@
   default_config["filament"]["number_fluctuation_centers"] = "10";
   default_config["filament"]["in_out_analysis"] = "false";
   default_config["filament"]["drive_from_bond_center"] = "true";
+  default_config["filament"]["n_respa"] = "1";
+  default_config["filament"]["implicit_bending"] = "false";
+  default_config["filament"]["fused_integrator"] = "false";
   default_config["filament"]["flagella_flag"] = "false";
   default_config["filament"]["flagella_freq"] = "1";
   default_config["filament"]["flagella_period"] = "2";
@@ -153,6 +156,7 @@
   default_config["crosslink"]["plus_end_pausing"] = "false";
   default_config["crosslink"]["r_capture"] = "5";
   default_config["crosslink"]["lut_grid_num"] = "256";
+  default_config["crosslink"]["event_driven_kinetics"] = "false";
   default_config["receptor"]["component"] = "cortex";
   default_config["receptor"]["concentration"] = "-1";
   default_config["receptor"]["induce_catastrophe"] = "false";
@@ -178,6 +182,7 @@
   default_config["draw_boundary"] = "true";
   default_config["load_checkpoint"] = "false";
   default_config["checkpoint_run_name"] = "sc";
+  default_config["checkpoint_step"] = "0";
   default_config["n_load"] = "0";
   default_config["movie_flag"] = "false";
   default_config["movie_directory"] = "frames";
@@ -200,6 +205,11 @@
   default_config["zero_temperature"] = "false";
   default_config["thermo_flag"] = "false";
   default_config["n_thermo"] = "1000";
+  default_config["async_output"] = "false";
+  default_config["output_queue_size"] = "2";
+  default_config["compact_output"] = "false";
+  default_config["compact_precision"] = "1.0e-6";
+  default_config["compact_keyframe_interval"] = "100";
   default_config["insert_radius"] = "-1";
   default_config["interaction_flag"] = "true";
   default_config["remove_duplicate_interactions"] = "false";
@@ -209,6 +219,9 @@
   default_config["species_insertion_reattempt_threshold"] = "10";
   default_config["uniform_crystal"] = "false";
   default_config["n_steps_equil"] = "0";
+  default_config["frame_parallel_analysis"] = "false";
+  default_config["insitu_analysis"] = "false";
+  default_config["async_insitu_analysis"] = "false";
   default_config["n_steps_target"] = "100000";
   default_config["static_particle_number"] = "false";
   default_config["checkpoint_from_spec"] = "false";
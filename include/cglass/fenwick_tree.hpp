@@ -0,0 +1,73 @@
+#ifndef _CGLASS_FENWICK_TREE_H_
+#define _CGLASS_FENWICK_TREE_H_
+
+#include <vector>
+
+/* Binary indexed tree over non-negative weights, used to draw an index with
+   probability proportional to its weight. Building is O(N), while weight
+   updates and draws are O(log N). */
+class FenwickTree {
+private:
+  std::vector<double> tree_;    // partial sums, 1-indexed
+  std::vector<double> weights_; // individual weights, 0-indexed
+  int size_ = 0;
+  int high_bit_ = 0;
+
+public:
+  /* Build the tree from a full set of weights */
+  void Build(std::vector<double> const &weights) {
+    weights_ = weights;
+    size_ = weights_.size();
+    tree_.assign(size_ + 1, 0);
+    for (int i = 1; i <= size_; ++i) {
+      tree_[i] += weights_[i - 1];
+      int parent = i + (i & -i);
+      if (parent <= size_) {
+        tree_[parent] += tree_[i];
+      }
+    }
+    high_bit_ = 1;
+    while (2 * high_bit_ <= size_) {
+      high_bit_ *= 2;
+    }
+  }
+  void Clear() {
+    tree_.clear();
+    weights_.clear();
+    size_ = high_bit_ = 0;
+  }
+  const int Size() const { return size_; }
+  const double GetWeight(int i) const { return weights_[i]; }
+  void SetWeight(int i, double w) {
+    double dw = w - weights_[i];
+    weights_[i] = w;
+    for (int j = i + 1; j <= size_; j += (j & -j)) {
+      tree_[j] += dw;
+    }
+  }
+  const double Total() const {
+    double sum = 0;
+    for (int j = size_; j > 0; j -= (j & -j)) {
+      sum += tree_[j];
+    }
+    return sum;
+  }
+  /* Returns the smallest index whose cumulative weight exceeds roll, or -1 if
+     roll is beyond the total weight */
+  const int Find(double roll) const {
+    int pos = 0;
+    for (int step = high_bit_; step > 0; step /= 2) {
+      if (pos + step <= size_ && tree_[pos + step] <= roll) {
+        pos += step;
+        roll -= tree_[pos];
+      }
+    }
+    /* Skip zero-weight entries that round-off may land on */
+    while (pos < size_ && weights_[pos] <= 0) {
+      pos++;
+    }
+    return (pos < size_ ? pos : -1);
+  }
+};
+
+#endif
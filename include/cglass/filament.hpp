@@ -20,7 +20,10 @@ private:
   bool nematic_driving_ = false;
   bool custom_set_tail_ = false;
   bool no_midstep_ = false;
+  bool implicit_bending_ = false;
+  bool fused_integrator_ = false;
   int n_normalize_ = 0;
+  int n_respa_ = 1;
   int optical_trap_fixed_ = 0;
   int trapped_site_ = 0;
   int n_step_ = 0;
@@ -78,6 +81,14 @@ private:
   std::vector<double> h_mat_upper_;   // n_sites-2
   std::vector<double> h_mat_lower_;   // n_sites-2
   std::vector<double> cos_thetas_;
+  std::vector<double> respa_forces_;  // 3*n_sites
+  std::vector<double> bend_diag_;     // n_sites
+  std::vector<double> bend_upper_;    // n_sites-1
+  std::vector<double> bend_upper2_;   // n_sites-2
+  std::vector<double> bend_disp_;     // n_sites
+  std::vector<double> fused_u_;       // 3*n_sites
+  std::vector<double> fused_utan_;    // 3*n_sites
+  std::vector<double> fused_f_;       // 3*n_sites
   poly_state poly_;
   void UpdateSiteBondPositions();
   void SetDiffusion();
@@ -89,7 +100,11 @@ private:
   void GeometricallyProjectRandomForces();
   void CalculateBendingForces();
   void CalculateTensions();
-  void UpdateSitePositions();
+  void UpdateSitePositions(double delta);
+  void IntegrateMultipleTimestep();
+  void ImplicitBendingCorrection(double delta);
+  void IntegrateFused();
+  void RenormalizeSites();
   void RotateToReferenceFrame();
   void ApplyForcesTorques();
   void ApplyInteractionForces();
@@ -149,12 +164,12 @@ public:
   void GetErrorRates(std::vector<int> &rates);
   void AddTorqueTail(double *t) { bonds_[0].AddTorque(t); }
   void AddForceTail(double *f) { sites_[0].AddForce(f); }
-  void WritePosit(std::fstream &oposit);
-  void ReadPosit(std::fstream &iposit);
-  void WriteSpec(std::fstream &ospec);
-  void ReadSpec(std::fstream &ispec);
-  void WriteCheckpoint(std::fstream &ocheck);
-  void ReadCheckpoint(std::fstream &icheck);
+  void WritePosit(FrameBuffer &oposit);
+  void ReadPosit(FrameReader &iposit);
+  void WriteSpec(FrameBuffer &ospec);
+  void ReadSpec(FrameReader &ispec);
+  void WriteCheckpoint(FrameBuffer &ocheck);
+  void ReadCheckpoint(FrameReader &icheck);
   void ScalePosition();
   double const GetVolume();
   void Depolymerize();
@@ -162,7 +177,8 @@ public:
 
   // Convert binary data to text. Static to avoid needing to istantiate
   // species members.
-  static void ConvertSpec(std::fstream &ispec, std::fstream &otext);
+  static void ConvertSpec(FrameReader &ispec, std::fstream &otext);
+  static void ExportSpec(FrameReader &ispec, ColumnFrame &columns);
 };
 
 typedef std::vector<Filament>::iterator filament_iterator;
@@ -53,7 +53,15 @@ protected:
   }
 
   void RunAnalysis() {
-    for (auto it = members_->begin(); it != members_->end(); ++it) {
+    analysis_frame frame;
+    MapFrame(*members_, time_, frame);
+    ReduceFrame(frame);
+  }
+
+  /* Tallies are flattened (bond, bin) indices into the histogram */
+  void MapFrame(std::vector<Filament> &members, double time,
+                analysis_frame &frame) {
+    for (auto it = members.begin(); it != members.end(); ++it) {
       std::vector<double> const *const thetas = it->GetThetas();
       for (int i = 0; i < (it->GetNBonds() - 1); ++i) {
         int bin_number = (int)floor((1 + (*thetas)[i]) * (n_bins_ / 2));
@@ -64,11 +72,17 @@ protected:
         } else if (bin_number > n_bins_ && bin_number < 0) {
           Logger::Error("Something went wrong in AngleDistributionAnalysis!");
         }
-        theta_histogram_[i][bin_number]++;
+        frame.counts.push_back(i * n_bins_ + bin_number);
       }
     }
   }
 
+  void ReduceFrame(analysis_frame &frame) {
+    for (auto bin = frame.counts.begin(); bin != frame.counts.end(); ++bin) {
+      theta_histogram_[*bin / n_bins_][*bin % n_bins_]++;
+    }
+  }
+
   void EndAnalysis() {
     int nbonds = members_->back().GetNBonds();
     for (int i = 0; i < n_bins_; ++i) {
@@ -85,6 +99,9 @@ protected:
     }
     delete[] theta_histogram_;
   }
+
+public:
+  bool IsFrameParallel() { return true; }
 };
 
 #endif // _CGLASS_FILAMENT_ANGLE_DISTRIBUTION_ANALYSIS_H_
@@ -7,9 +7,6 @@
 
 class GlobalOrderAnalysis : public Analysis<Filament, species_id::filament> {
 protected:
-  double *nematic_order_tensor_;
-  double *polar_order_vector_;
-
   void InitOutput() {
     SetAnalysisName("global_order");
     Analysis::InitOutput();
@@ -22,22 +19,26 @@ protected:
            "nematic_order_yz nematic_order_zx nematic_order_zy nematic_order_zz "
            "spiral_order signed_spiral_order n_spooling "
            "avg_spool_spiral_number\n";
-    nematic_order_tensor_ = new double[9];
-    polar_order_vector_ = new double[3];
-    std::fill(nematic_order_tensor_, nematic_order_tensor_ + 9, 0.0);
-    std::fill(polar_order_vector_, polar_order_vector_ + 3, 0.0);
   }
   void RunAnalysis() {
+    analysis_frame frame;
+    MapFrame(*members_, time_, frame);
+    ReduceFrame(frame);
+  }
+  void MapFrame(std::vector<Filament> &members, double time,
+                analysis_frame &frame) {
+    double nematic_order_tensor[9] = {0};
+    double polar_order_vector[3] = {0};
     double sn_tot = 0.0;
     double sn_mag = 0.0;
     double sn_spools = 0;
     int n_spooling = 0;
     double sn;
-    for (auto it = members_->begin(); it != members_->end(); ++it) {
+    for (auto it = members.begin(); it != members.end(); ++it) {
       it->CalculateSpiralNumber();
       sn = it->GetSpiralNumber();
-      it->GetPolarOrder(polar_order_vector_);
-      it->GetNematicOrder(nematic_order_tensor_);
+      it->GetPolarOrder(polar_order_vector);
+      it->GetNematicOrder(nematic_order_tensor);
       sn_mag += ABS(sn);
       sn_tot += sn;
       if (sn > 0.7) {
@@ -53,35 +54,32 @@ protected:
       sn_spools = 0;
     }
     for (int i = 0; i < 3; ++i) {
-      polar_order_vector_[i] /= n_members_;
+      polar_order_vector[i] /= n_members_;
     }
     for (int i = 0; i < 9; ++i) {
-      nematic_order_tensor_[i] /= n_members_;
+      nematic_order_tensor[i] /= n_members_;
     }
+    std::ostringstream line;
+    line << time << " " << polar_order_vector[0] << " "
+         << polar_order_vector[1] << " " << polar_order_vector[2] << " "
+         << nematic_order_tensor[0] << " " << nematic_order_tensor[1] << " "
+         << nematic_order_tensor[2] << " " << nematic_order_tensor[3] << " "
+         << nematic_order_tensor[4] << " " << nematic_order_tensor[5] << " "
+         << nematic_order_tensor[6] << " " << nematic_order_tensor[7] << " "
+         << nematic_order_tensor[8] << " " << sn_mag << " " << sn_tot << " "
+         << n_spooling << " " << sn_spools << "\n";
+    frame.output = line.str();
+  }
+  void ReduceFrame(analysis_frame &frame) {
     if (output_.is_open()) {
-      output_ << time_ << " " << polar_order_vector_[0] << " "
-                         << polar_order_vector_[1] << " "
-                         << polar_order_vector_[2] << " "
-                         << nematic_order_tensor_[0] << " "
-                         << nematic_order_tensor_[1] << " "
-                         << nematic_order_tensor_[2] << " "
-                         << nematic_order_tensor_[3] << " "
-                         << nematic_order_tensor_[4] << " "
-                         << nematic_order_tensor_[5] << " "
-                         << nematic_order_tensor_[6] << " "
-                         << nematic_order_tensor_[7] << " "
-                         << nematic_order_tensor_[8] << " " << sn_mag << " "
-                         << sn_tot << " " << n_spooling << " " << sn_spools
-                         << "\n";
+      output_ << frame.output;
     } else {
       Logger::Error("Problem opening output file in GlobalOrderAnalysis!");
     }
   }
 
-  void EndAnalysis() {
-    delete[] nematic_order_tensor_;
-    delete[] polar_order_vector_;
-  }
+public:
+  bool IsFrameParallel() { return true; }
 };
 
 #endif // _CGLASS_FILAMENT_GLOBAL_ORDER_ANALYSIS_H_
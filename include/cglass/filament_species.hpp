@@ -40,6 +40,9 @@ class FilamentSpecies : public Species<Filament, species_id::filament> {
   void CleanUp();
   virtual const double GetSpecLength() const;
   virtual void CalcPCPosition(int i, double s, double* pos);
+  const bool CheckInteractorSizeUpdate() {
+    return sparams_.dynamic_instability_flag;
+  }
   // Redundant for filaments.
   virtual void CenteredOrientedArrangement() {}
 
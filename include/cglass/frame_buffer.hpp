@@ -0,0 +1,83 @@
+#ifndef _CGLASS_FRAME_BUFFER_H_
+#define _CGLASS_FRAME_BUFFER_H_
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/* How compact output stores an 8-byte field. Writes are exact unless the
+   writer declares what the value is. */
+enum field_kind : unsigned char {
+  field_exact = 0,  // stored without loss
+  field_length = 1, // length, rounded to the length quantum
+  field_unit = 2,   // dimensionless value of order one, e.g. an orientation
+                    // component, scaled position or angle
+};
+
+struct frame_field {
+  int size;
+  field_kind kind;
+};
+
+/* Contiguous buffer that a whole output frame is serialized into before it is
+   written to file in a single call. Mirrors the write method of std::ostream,
+   so object writers produce the same bytes they would write to a stream. The
+   storage is kept between frames, so after the first frame of a species no
+   further allocation happens unless the frame grows. */
+class FrameBuffer {
+private:
+  std::vector<char> buffer_;
+  size_t size_ = 0;
+  bool record_fields_ = false;
+  std::vector<frame_field> fields_; // each write, if recorded
+
+public:
+  FrameBuffer &write(const char *data, std::streamsize n) {
+    return write(data, n, field_exact);
+  }
+  /* Write a field of the given kind, e.g. field_length for positions */
+  FrameBuffer &write(const char *data, std::streamsize n, field_kind kind) {
+    if (size_ + n > buffer_.size()) {
+      buffer_.resize(2 * (size_ + n));
+    }
+    std::memcpy(&buffer_[size_], data, n);
+    size_ += n;
+    if (record_fields_) {
+      frame_field field = {(int)n, kind};
+      fields_.push_back(field);
+    }
+    return *this;
+  }
+  const size_t Size() const { return size_; }
+  const char *Data() const { return (size_ > 0 ? &buffer_[0] : nullptr); }
+  /* Keep track of the size and kind of each write, which compact output uses
+     to tell the fields of a frame apart and to choose how each is stored */
+  void RecordFields(bool record) { record_fields_ = record; }
+  std::vector<frame_field> const &Fields() const { return fields_; }
+  void Clear() {
+    size_ = 0;
+    fields_.clear();
+  }
+  /* Exchange contents with another buffer without copying */
+  void Swap(FrameBuffer &that) {
+    buffer_.swap(that.buffer_);
+    std::swap(size_, that.size_);
+    fields_.swap(that.fields_);
+  }
+  /* Write the buffered frame to file and start a new frame */
+  void Flush(std::fstream &out) {
+    if (size_ > 0) {
+      out.write(&buffer_[0], size_);
+    }
+    Clear();
+  }
+  /* Replace the contents of file_name with the buffered frame. The frame is
+     written to a temporary file that is then renamed over file_name, so a
+     crash while writing never leaves file_name partially written. */
+  bool Replace(std::string const &file_name);
+};
+
+#endif
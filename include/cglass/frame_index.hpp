@@ -0,0 +1,76 @@
+#ifndef _CGLASS_FRAME_INDEX_H_
+#define _CGLASS_FRAME_INDEX_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/* Sidecar index for posit and spec files, written to <output file>.idx with one
+   fixed-size record per frame: the simulation step the frame was written on,
+   the byte offset of the frame (at its member count) in the output file, and
+   the member count. Lets readers seek to any frame without streaming through
+   the variable-length frames before it. */
+struct frame_index_entry {
+  int step;
+  int64_t offset;
+  int n_members;
+};
+
+inline void WriteFrameIndexEntry(std::fstream &oindex,
+                                 frame_index_entry const &entry) {
+  oindex.write(reinterpret_cast<const char *>(&entry.step), sizeof(int));
+  oindex.write(reinterpret_cast<const char *>(&entry.offset), sizeof(int64_t));
+  oindex.write(reinterpret_cast<const char *>(&entry.n_members), sizeof(int));
+}
+
+/* Read all records of an index file. Returns false if the file does not
+   exist, in which case index is left empty. */
+inline bool ReadFrameIndex(std::string const &file_name,
+                           std::vector<frame_index_entry> &index) {
+  index.clear();
+  std::fstream iindex(file_name, std::ios::in | std::ios::binary);
+  if (!iindex.is_open()) {
+    return false;
+  }
+  frame_index_entry entry;
+  while (iindex.read(reinterpret_cast<char *>(&entry.step), sizeof(int)) &&
+         iindex.read(reinterpret_cast<char *>(&entry.offset),
+                     sizeof(int64_t)) &&
+         iindex.read(reinterpret_cast<char *>(&entry.n_members),
+                     sizeof(int))) {
+    index.push_back(entry);
+  }
+  return true;
+}
+
+/* Steps visited by post-processing to process frames first_frame,
+   first_frame + frame_stride, ... up to, but not including, stop_frame (or
+   through last_step if stop_frame is negative). Each visited step processes
+   the frame that is loaded and then reads frame i_step / n_frame_steps, so
+   every frame is processed on the step that reads the next selected frame,
+   and first_frame is read on initial_step, before the first visited step. */
+struct frame_steps {
+  int initial_step;
+  int first_step;
+  int last_step;
+  int step_stride;
+};
+
+inline frame_steps GetFrameSteps(int first_frame, int stop_frame,
+                                 int frame_stride, int n_frame_steps,
+                                 int last_step) {
+  frame_steps steps;
+  steps.initial_step = first_frame * n_frame_steps;
+  steps.step_stride = frame_stride * n_frame_steps;
+  steps.first_step = steps.initial_step + steps.step_stride;
+  steps.last_step = last_step;
+  if (stop_frame >= 0) {
+    steps.last_step = std::min(
+        last_step, (stop_frame - 1 + frame_stride) * n_frame_steps);
+  }
+  return steps;
+}
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef _CGLASS_FRAME_READER_H_
+#define _CGLASS_FRAME_READER_H_
+
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+class TrajectoryDecoder;
+
+/* Read-only memory map of an output file (posit, spec or checkpoint). Mirrors
+   the parts of std::fstream used to read outputs, so object readers decode
+   their fields straight from the mapped bytes with a memcpy per field rather
+   than a stream call per field. Reading past the end copies what remains and
+   sets eof, as a stream would. Files in the compact output format are decoded
+   a frame at a time, and offsets passed to seekg are then frame offsets from
+   the frame index. */
+class FrameReader {
+private:
+  const char *data_ = nullptr;
+  size_t size_ = 0;
+  size_t pos_ = 0;
+  bool open_ = false;
+  bool eof_ = false;
+  void *map_ = nullptr;
+  std::unique_ptr<TrajectoryDecoder> decoder_; // set for compact files
+  std::vector<char> frame_;                    // decoded frame
+  size_t frame_pos_ = 0;
+  FrameReader &ReadDecoded(char *data, std::streamsize n);
+
+public:
+  FrameReader();
+  ~FrameReader();
+  FrameReader(const FrameReader &) = delete;
+  FrameReader &operator=(const FrameReader &) = delete;
+  void open(std::string const &file_name,
+            std::ios::openmode mode = std::ios::in | std::ios::binary);
+  /* Read from size bytes at data, which must outlive the reader */
+  void open(const char *data, size_t size);
+  bool is_open() const { return open_; }
+  void close();
+  FrameReader &read(char *data, std::streamsize n) {
+    if (decoder_) {
+      return ReadDecoded(data, n);
+    }
+    size_t n_read = n;
+    if (pos_ + n_read > size_) {
+      n_read = (pos_ < size_ ? size_ - pos_ : 0);
+      eof_ = true;
+    }
+    if (n_read > 0) {
+      std::memcpy(data, data_ + pos_, n_read);
+    }
+    pos_ += n_read;
+    return *this;
+  }
+  bool eof() const { return eof_; }
+  void clear() { eof_ = false; }
+  void seekg(std::streamoff offset);
+  std::streamoff tellg() const { return pos_; }
+  size_t Size() const { return size_; }
+};
+
+#endif
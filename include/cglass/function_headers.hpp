@@ -13,6 +13,12 @@ void cross_product(double const *const a, double const *const b, double *c,
 void normalize_vector(double *a, int n_dim);
 void tridiagonal_solver(std::vector<double> *a, std::vector<double> *b,
                         std::vector<double> *c, std::vector<double> *d, int n);
+void pentadiagonal_factorize(std::vector<double> *d, std::vector<double> *c,
+                             std::vector<double> *e, int n);
+void pentadiagonal_solve(std::vector<double> const *const d,
+                         std::vector<double> const *const c,
+                         std::vector<double> const *const e,
+                         std::vector<double> *b, int n);
 void invert_sym_2d_matrix(double *a, double *b);
 void invert_sym_3d_matrix(double *a, double *b);
 void periodic_boundary_conditions(int n_dim, int n_periodic, double *h,
@@ -53,6 +53,8 @@ class InteractionManager {
   void CheckUpdateXlinks();
   void CheckUpdateInteractions();
   void UpdateInteractors();
+  void UpdateInteractorsIncremental(std::vector<Object *> const &added,
+                                    std::vector<Object *> const &removed);
   void UpdateInteractions();
   void UpdatePairInteractions();
   void UpdateBoundaryInteractions();
@@ -96,7 +98,11 @@ class InteractionManager {
   void InitOutputs(bool reading_inputs = false,
                    run_options *run_opts = nullptr);
   void ReadInputs();
+  bool HasFrameIndex() { return xlink_.HasFrameIndex(); }
+  void SetSeekFrames(bool seek) { xlink_.SetSeekFrames(seek); }
+  int GetInputFrameInterval() { return xlink_.GetInputFrameInterval(); }
   void Convert();
+  void ExportColumns();
   void ResetCellList();
   void InitCrosslinkSpecies(sid_label &slab, ParamsParser &parser,
                             unsigned long seed);
@@ -105,6 +111,7 @@ class InteractionManager {
   void InsertCrosslinks();
   void InsertAttachedCrosslinks();
   void SetInteractionAnalysis(bool set) { run_interaction_analysis_ = set; }
+  bool GetInteractionAnalysis() const { return run_interaction_analysis_; }
 };
 
 #endif
@@ -0,0 +1,47 @@
+#ifndef _CGLASS_JOB_RUNNER_H_
+#define _CGLASS_JOB_RUNNER_H_
+
+#include "logger.hpp"
+#include <set>
+#include <string>
+#include <sys/types.h>
+#include <vector>
+
+/* Local scheduler for batch simulations. Each parameter file of the batch is
+   run by a separate cglass process, up to n_jobs at a time, with the OpenMP
+   threads split evenly between them. Completed runs are recorded in a status
+   file, so rerunning an interrupted batch skips them and resumes the others
+   from their latest checkpoint files, if any, for the steps that remain after
+   the recorded checkpoint step. */
+class JobRunner {
+private:
+  struct job {
+    std::string param_file;
+    std::string run_name;
+    pid_t pid = -1;
+  };
+  std::string exe_;
+  std::string status_file_;
+  int n_jobs_ = 1;
+  int n_threads_ = 0; // threads per job, 0 to leave unset
+  bool debug_ = false;
+  std::set<std::string> completed_;
+  void LoadStatus();
+  void RecordCompleted(std::string const &param_file);
+  std::string GetRunName(std::string const &param_file) const;
+  std::string GetReloadName(std::string const &run_name) const;
+  std::string FindLatestCheckpointRun(std::string const &run_name) const;
+  bool HasCheckpoint(std::string const &run_name) const;
+  int GetCheckpointStep(std::string const &run_name) const;
+  std::string WriteResumeParams(job const &j,
+                                std::string const &checkpoint_run,
+                                int checkpoint_step) const;
+  bool Launch(job &j);
+
+public:
+  void Init(std::string exe, std::string batch_name, int n_jobs, bool debug);
+  /* Run every parameter file, returning the number of runs that failed */
+  int Run(std::vector<std::string> const &param_files);
+};
+
+#endif
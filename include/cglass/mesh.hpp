@@ -3,6 +3,7 @@
 
 #include "bond.hpp"
 #include "composite.hpp"
+#include <unordered_map>
 
 typedef std::vector<Bond>::iterator bond_iterator;
 typedef std::vector<Site>::iterator site_iterator;
@@ -20,11 +21,19 @@ class Mesh : public Composite {
   std::vector<Site> sites_;
   std::vector<Site*> site_ptrs_; // for meshes w/ sites that are species
   std::vector<Bond> bonds_;
+  /* Bonds added or removed since the interactors were last gathered, used to
+     update the interaction engine without a full rebuild */
+  std::vector<Object *> added_interactors_;
+  std::vector<Object *> removed_interactors_;
+  /* Bond index by OID. Bond OIDs are reassigned when reading checkpoints, so
+     entries are checked on lookup and the index is rebuilt on a miss. */
+  std::unordered_map<int, int> bond_oid_index_;
   double bond_length_ = -1;
   double true_length_ = -1;
   Bond *GetRandomBond();
   virtual void UpdateInteractors();
   void UpdateSiteOrientations();
+  void IndexBondOIDs();
   void RelocateMesh(double const *const new_pos, double const *const u);
   
  public:
@@ -58,17 +67,20 @@ class Mesh : public Composite {
   void HalfGranularityLinear();
   int GetNBonds() { return n_bonds_; }
   Bond *GetBondAtLambda(double lambda);
+  Bond *GetBondByOID(int bond_oid);
   Site *GetSite(int i);
   Bond *GetBond(int i);
   virtual void ZeroForce();
   virtual void GetInteractors(std::vector<Object *> &ix);
+  virtual void GetInteractorUpdates(std::vector<Object *> &added,
+                                    std::vector<Object *> &removed);
   virtual int GetCount();
-  virtual void ReadPosit(std::fstream &ip);
-  virtual void WritePosit(std::fstream &op);
-  virtual void ReadSpec(std::fstream &ip);
-  virtual void WriteSpec(std::fstream &op);
-  virtual void ReadCheckpoint(std::fstream &ip);
-  virtual void WriteCheckpoint(std::fstream &op);
+  virtual void ReadPosit(FrameReader &ip);
+  virtual void WritePosit(FrameBuffer &op);
+  virtual void ReadSpec(FrameReader &ip);
+  virtual void WriteSpec(FrameBuffer &op);
+  virtual void ReadCheckpoint(FrameReader &ip);
+  virtual void WriteCheckpoint(FrameBuffer &op);
   virtual void ScalePosition();
   virtual void UpdateDrTot();
   virtual double const GetDrTot();
@@ -93,7 +105,8 @@ class Mesh : public Composite {
 
   // Convert binary data to text. Static to avoid needing to istantiate
   // species members.
-  static void ConvertSpec(std::fstream &ispec, std::fstream &otext);
+  static void ConvertSpec(FrameReader &ispec, std::fstream &otext);
+  static void ExportSpec(FrameReader &ispec, ColumnFrame &columns);
   static void WriteSpecTextHeader(std::fstream &otext);
 };
 
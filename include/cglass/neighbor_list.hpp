@@ -1,13 +1,12 @@
 #include "auxiliary.hpp"
 #include "rod.hpp"
 #include "sphere.hpp"
-#include <mutex>
 
 /* A data structure that is used to hold a list of particles that are nearby the
- * owner of the list in a thread-safe way. */
+ * owner of the list. Lists are filled from a single thread, rods before
+ * spheres, in the order KMC should see them. */
 class NeighborList {
 private:
-  std::mutex mtx_;
   std::vector<Object *> nlist_;
   std::vector<const Rod *> nlist_rod_;
   std::vector<const Sphere *> nlist_sphere_;
@@ -20,24 +19,25 @@ public:
     this->nlist_ = that.nlist_;
     return *this;
   }
-  void AddNeighbor(Object *obj) {
-    std::lock_guard<std::mutex> lk(mtx_);
-    nlist_.push_back(obj);
-    switch(obj->GetShape()) { 
-      case shape::rod:
-        nlist_rod_.push_back(dynamic_cast<const Rod*>(obj));
-        break;
-      case shape::sphere:
-        if (obj->GetNAnchored() == 0) {
-          nlist_sphere_.push_back(dynamic_cast<const Sphere*>(obj));
-        }
-        break;
-      default:
-        break;
-    }
+  NeighborList(NeighborList &&that) noexcept
+      : nlist_(std::move(that.nlist_)), nlist_rod_(std::move(that.nlist_rod_)),
+        nlist_sphere_(std::move(that.nlist_sphere_)) {}
+  NeighborList &operator=(NeighborList &&that) noexcept {
+    nlist_ = std::move(that.nlist_);
+    nlist_rod_ = std::move(that.nlist_rod_);
+    nlist_sphere_ = std::move(that.nlist_sphere_);
+    return *this;
+  }
+  void AddNeighbor(const Rod *rod) {
+    nlist_.push_back(const_cast<Rod *>(rod));
+    nlist_rod_.push_back(rod);
+  }
+  void AddNeighbor(const Sphere *sphere) {
+    nlist_.push_back(const_cast<Sphere *>(sphere));
+    nlist_sphere_.push_back(sphere);
   }
   const Object *const *GetNeighborListMem() { return &nlist_[0]; }
-  
+
   const std::vector<const Rod*>& GetNeighborListMemRods() {
     return nlist_rod_;
   }
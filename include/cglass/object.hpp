@@ -2,6 +2,9 @@
 #define _CGLASS_OBJECT_H_
 
 #include "auxiliary.hpp"
+#include "column_writer.hpp"
+#include "frame_buffer.hpp"
+#include "frame_reader.hpp"
 #include "interaction.hpp"
 #include "rng.hpp"
 #include <mutex>
@@ -11,6 +14,7 @@ private:
   int comp_id_;
   static int _next_oid_;
   static std::mutex _obj_mtx_;
+  static std::map<std::string, int> _name_ids_;
   void InitOID();
   Object *comp_ptr_; // If part of a composite
 
@@ -21,6 +25,7 @@ protected:
   static int n_dim_;
   static double delta_;
   std::string name_;
+  int name_id_; // interned name_, kept in sync by SetName
   species_id sid_;
   obj_type type_ = obj_type::generic;
   comp_type comp_type_ = comp_type::generic;
@@ -59,6 +64,10 @@ protected:
 public:
   Object(unsigned long seed);
   virtual ~Object() = default;
+  Object(const Object &) = default;
+  Object &operator=(const Object &) = default;
+  Object(Object &&) = default;
+  Object &operator=(Object &&) = default;
   // kmcx parameter
   int gid;
   double length;
@@ -77,6 +86,7 @@ public:
   // Trivial Set/Get functions
   void SetSID(species_id sid);
   void SetType(obj_type type);
+  void SetName(std::string const &name);
   void SetPosition(const double *const new_pos);
   void SetScaledPosition(const double *const spos);
   void SetOrientation(const double *const u);
@@ -104,6 +114,9 @@ public:
   comp_type const GetCompType();
   shape const GetShape();
   const std::string& GetName() const;
+  const int GetNameID() const;
+  static const int InternName(std::string const &name);
+  static const int GetNNames();
   const int GetOID() const;
   const int GetCompID() const;
   const double *const GetPosition();
@@ -145,6 +158,8 @@ public:
   virtual void ScalePosition();
   virtual int GetCount();
   virtual void GetInteractors(std::vector<Object *> &ix);
+  virtual void GetInteractorUpdates(std::vector<Object *> &added,
+                                    std::vector<Object *> &removed);
   virtual const double *const GetInteractorPosition();
   virtual const double *const GetInteractorPrevPosition();
   virtual const double *const GetInteractorScaledPosition();
@@ -167,21 +182,22 @@ public:
 
   // I/O functions
   virtual void Report();
-  virtual void WritePosit(std::fstream &oposit);
-  virtual void ReadPosit(std::fstream &iposit);
-  virtual void WriteSpec(std::fstream &ospec);
-  virtual void ReadSpec(std::fstream &ispec);
-  virtual void ReadPositFromSpec(std::fstream &ispec);
-  virtual void WriteCheckpoint(std::fstream &ocheck);
-  virtual void WriteCheckpointHeader(std::fstream &ocheck);
-  virtual void ReadCheckpoint(std::fstream &icheck);
-  virtual void ReadCheckpointHeader(std::fstream &icheck);
+  virtual void WritePosit(FrameBuffer &oposit);
+  virtual void ReadPosit(FrameReader &iposit);
+  virtual void WriteSpec(FrameBuffer &ospec);
+  virtual void ReadSpec(FrameReader &ispec);
+  virtual void ReadPositFromSpec(FrameReader &ispec);
+  virtual void WriteCheckpoint(FrameBuffer &ocheck);
+  virtual void WriteCheckpointHeader(FrameBuffer &ocheck);
+  virtual void ReadCheckpoint(FrameReader &icheck);
+  virtual void ReadCheckpointHeader(FrameReader &icheck);
   virtual Object *GetCompPtr() { return comp_ptr_; }
 
   // Convert binary data to text. Static to avoid needing to istantiate
   // species members.
-  static void ConvertPosit(std::fstream &iposit, std::fstream &otext);
-  static void ConvertSpec(std::fstream &ispec, std::fstream &otext);
+  static void ConvertPosit(FrameReader &iposit, std::fstream &otext);
+  static void ConvertSpec(FrameReader &ispec, std::fstream &otext);
+  static void ExportSpec(FrameReader &ispec, ColumnFrame &columns);
   static void WritePositTextHeader(std::fstream &otext);
   static void WriteSpecTextHeader(std::fstream &otext);
 };
@@ -1,6 +1,7 @@
 #ifndef _CGLASS_OUTPUT_MANAGER_H_
 #define _CGLASS_OUTPUT_MANAGER_H_
 
+#include "async_writer.hpp"
 #include "parse_flags.hpp"
 #include "species.hpp"
 
@@ -15,6 +16,8 @@ private:
   bool thermo_analysis_ = false;
   bool with_reloads_ = false;
   bool convert_ = false;
+  bool columns_ = false;
+  bool seek_frames_ = false; // position inputs with frame index files
   int n_posit_;
   int n_spec_;
   int n_checkpoint_;
@@ -35,6 +38,8 @@ private:
   void WriteReduce();
   void WriteTime();
   std::fstream othermo_file_;
+  FrameBuffer othermo_frame_;
+  AsyncWriter writer_;
   std::fstream ithermo_file_;
   std::fstream time_file_;
 
@@ -48,8 +53,12 @@ public:
   int GetNCheckpoint() { return n_checkpoint_; }
   void WriteOutputs();
   void Convert();
+  void ExportColumns();
   void InitInputs();
   void ReadInputs();
+  bool HasFrameIndex();
+  void SetSeekFrames(bool seek) { seek_frames_ = seek; }
+  int GetInputFrameInterval();
   void Close();
 };
 
@@ -73,6 +82,11 @@ void OutputManagerBase<T>::Init(system_parameters *params,
     with_reloads_ = run_opts->with_reloads;
     posits_only_ = run_opts->use_posits;
     convert_ = run_opts->convert;
+    columns_ = run_opts->columns;
+  }
+  /* Only frames written during a simulation run go through the writer thread */
+  if (params_->async_output && !reading_inputs && !convert_) {
+    writer_.Start(params_->output_queue_size);
   }
   if (thermo_flag_ && !reading_inputs && !reduce_flag_) {
     InitThermo(run_name_);
@@ -83,7 +97,9 @@ void OutputManagerBase<T>::Init(system_parameters *params,
   }
 
   for (auto it = species_->begin(); it != species_->end(); ++it) {
-    if (convert_) {
+    if (columns_) {
+      (*it)->InitColumnFiles(run_name_);
+    } else if (convert_) {
       (*it)->InitConvertFiles(run_name_);
     } else {
       if (!params_->load_checkpoint && reading_inputs) {
@@ -99,6 +115,9 @@ void OutputManagerBase<T>::Init(system_parameters *params,
         (*it)->InitOutputFiles(run_name_);
       }
     }
+    if (writer_.IsRunning()) {
+      (*it)->SetOutputWriter(&writer_);
+    }
     if ((*it)->GetPositFlag()) {
       posit_flag_ = true;
       if ((*it)->GetNPosit() < n_posit_) {
@@ -160,12 +179,31 @@ template <class T> void OutputManagerBase<T>::WriteSpecs() {
   }
 }
 
+/* Once every species has checkpointed at the same step, the number of steps
+   simulated up to that step, counting the runs this one was reloaded from, is
+   recorded in run_name.checkpoint_step so that interrupted runs can be resumed
+   for the remaining steps only */
 template <class T> void OutputManagerBase<T>::WriteCheckpoints() {
+  bool all_written = true;
   for (auto spec = species_->begin(); spec != species_->end(); ++spec) {
-    if ((*spec)->GetCheckpointFlag() &&
-        params_->i_step != params_->prev_step &&
+    if (!(*spec)->GetCheckpointFlag()) {
+      continue;
+    }
+    if (params_->i_step != params_->prev_step &&
         params_->i_step % (inv_step_fact_*(*spec)->GetNCheckpoint()) == 0) {
       (*spec)->WriteCheckpoints();
+    } else {
+      all_written = false;
+    }
+  }
+  if (all_written) {
+    std::string step = std::to_string(params_->checkpoint_step +
+                                      params_->i_step / inv_step_fact_) + "\n";
+    FrameBuffer ostep;
+    ostep.write(step.c_str(), step.size());
+    if (!ostep.Replace(run_name_ + ".checkpoint_step")) {
+      Logger::Warning("Unable to record checkpoint step in %s.checkpoint_step",
+                      run_name_.c_str());
     }
   }
 }
@@ -186,17 +224,23 @@ template <class T> void OutputManagerBase<T>::InitThermo(std::string fname) {
 
 template <class T> void OutputManagerBase<T>::WriteThermo() {
   for (int i = 0; i < 9; ++i) {
-    othermo_file_.write(reinterpret_cast<char *>(&(space_->unit_cell[i])),
-                        sizeof(double));
+    othermo_frame_.write(reinterpret_cast<char *>(&(space_->unit_cell[i])),
+                         sizeof(double));
   }
   for (int i = 0; i < 9; ++i) {
-    othermo_file_.write(reinterpret_cast<char *>(&(space_->pressure_tensor[i])),
-                        sizeof(double));
+    othermo_frame_.write(
+        reinterpret_cast<char *>(&(space_->pressure_tensor[i])),
+        sizeof(double));
+  }
+  othermo_frame_.write(reinterpret_cast<char *>(&(space_->pressure)),
+                       sizeof(double));
+  othermo_frame_.write(reinterpret_cast<char *>(&(space_->volume)),
+                       sizeof(double));
+  if (writer_.IsRunning()) {
+    writer_.Submit(othermo_frame_, othermo_file_);
+  } else {
+    othermo_frame_.Flush(othermo_file_);
   }
-  othermo_file_.write(reinterpret_cast<char *>(&(space_->pressure)),
-                      sizeof(double));
-  othermo_file_.write(reinterpret_cast<char *>(&(space_->volume)),
-                      sizeof(double));
 }
 
 template <class T> void OutputManagerBase<T>::ReadThermo() {
@@ -214,6 +258,41 @@ template <class T> void OutputManagerBase<T>::ReadThermo() {
                      sizeof(double));
 }
 
+/* Whether every input file read by ReadInputs has a frame index */
+template <class T> bool OutputManagerBase<T>::HasFrameIndex() {
+  for (auto spec = species_->begin(); spec != species_->end(); ++spec) {
+    if (posits_only_ && (*spec)->GetPositFlag()) {
+      if (!(*spec)->HasFrameIndex(true)) return false;
+    } else if ((*spec)->GetSpecFlag()) {
+      if (!(*spec)->HasFrameIndex(false)) return false;
+    }
+  }
+  return true;
+}
+
+/* Number of steps between consecutive input frames of any species, i.e. the
+   greatest common divisor of the input frame intervals, or 0 if nothing is
+   read */
+template <class T> int OutputManagerBase<T>::GetInputFrameInterval() {
+  int n_frame = 0;
+  for (auto spec = species_->begin(); spec != species_->end(); ++spec) {
+    int n_spec_frame = 0;
+    if (posits_only_ && (*spec)->GetPositFlag()) {
+      n_spec_frame = (*spec)->GetNPosit();
+    } else if ((*spec)->GetSpecFlag()) {
+      n_spec_frame = (*spec)->GetNSpec();
+    }
+    while (n_spec_frame > 0) {
+      int rem = n_frame % n_spec_frame;
+      n_frame = n_spec_frame;
+      n_spec_frame = rem;
+    }
+  }
+  return n_frame;
+}
+
+/* When seeking frames, the frame read on step i_step is the one a sequential
+   read would reach, i.e. frame number i_step / (frame interval) */
 template <class T> void OutputManagerBase<T>::ReadInputs() {
   // if ( params_->i_step % n_posit_ != 0 && params_->i_step % n_spec_ != 0) {
   // return;
@@ -222,6 +301,10 @@ template <class T> void OutputManagerBase<T>::ReadInputs() {
     if (posits_only_ && (*spec)->GetPositFlag() &&
         params_->i_step != params_->prev_step &&
         params_->i_step % (inv_step_fact_*(*spec)->GetNPosit()) == 0) {
+      if (seek_frames_ && !(*spec)->SeekPositFrame(
+              params_->i_step / (inv_step_fact_ * (*spec)->GetNPosit()))) {
+        continue;
+      }
       (*spec)->ReadPosits();
     }
     // In the case that we only want to consider posits, but we only have spec
@@ -230,10 +313,18 @@ template <class T> void OutputManagerBase<T>::ReadInputs() {
              (*spec)->GetSpecFlag() &&
              params_->i_step != params_->prev_step &&
              params_->i_step % (inv_step_fact_*(*spec)->GetNSpec()) == 0) {
+      if (seek_frames_ && !(*spec)->SeekSpecFrame(
+              params_->i_step / (inv_step_fact_ * (*spec)->GetNSpec()))) {
+        continue;
+      }
       (*spec)->ReadPositsFromSpecs();
     } else if (!posits_only_ && (*spec)->GetSpecFlag() &&
              params_->i_step != params_->prev_step &&
                params_->i_step % (inv_step_fact_*(*spec)->GetNSpec()) == 0) {
+      if (seek_frames_ && !(*spec)->SeekSpecFrame(
+              params_->i_step / (inv_step_fact_ * (*spec)->GetNSpec()))) {
+        continue;
+      }
       (*spec)->ReadSpecs();
       if (params_->checkpoint_from_spec && params_->i_step %
           (inv_step_fact_*(*spec)->GetNCheckpoint()) == 0 &&
@@ -272,7 +363,10 @@ template <class T> void OutputManagerBase<T>::WriteReduce() {
 }
 
 template <class T> void OutputManagerBase<T>::Close() {
+  /* Finish writing queued frames before their files are closed */
+  writer_.Stop();
   for (auto spec = species_->begin(); spec != species_->end(); ++spec) {
+    (*spec)->SetOutputWriter(nullptr);
     (*spec)->CloseFiles();
   }
   if (ithermo_file_.is_open()) {
@@ -308,6 +402,13 @@ template <class T> void OutputManagerBase<T>::Convert() {
   }
 }
 
+/* Export all existing spec files to columnar .npy files */
+template <class T> void OutputManagerBase<T>::ExportColumns() {
+  for (auto spec = species_->begin(); spec != species_->end(); ++spec) {
+    (*spec)->ExportColumns(run_name_);
+  }
+}
+
 class OutputManager : public OutputManagerBase<SpeciesBase> {};
 
 #endif //_CGLASS_OUTPUT_MANAGER_H_
@@ -89,6 +89,9 @@ struct species_parameters<species_id::filament>
   int number_fluctuation_centers = 10;
   bool in_out_analysis = false;
   bool drive_from_bond_center = true;
+  int n_respa = 1;
+  bool implicit_bending = false;
+  bool fused_integrator = false;
   bool flagella_flag = false;
   double flagella_freq = 1;
   double flagella_period = 2;
@@ -182,6 +185,7 @@ struct species_parameters<species_id::crosslink>
   bool plus_end_pausing = false;
   double r_capture = 5;
   int lut_grid_num = 256;
+  bool event_driven_kinetics = false;
   struct anchor_parameters {
     double velocity_s = 0;
     double velocity_d = 0;
@@ -229,6 +233,7 @@ struct system_parameters {
   bool draw_boundary = true;
   bool load_checkpoint = false;
   std::string checkpoint_run_name = "sc";
+  int checkpoint_step = 0;
   int n_load = 0;
   bool movie_flag = false;
   std::string movie_directory = "frames";
@@ -251,6 +256,11 @@ struct system_parameters {
   bool zero_temperature = false;
   bool thermo_flag = false;
   int n_thermo = 1000;
+  bool async_output = false;
+  int output_queue_size = 2;
+  bool compact_output = false;
+  double compact_precision = 1.0e-6;
+  int compact_keyframe_interval = 100;
   double insert_radius = -1;
   bool interaction_flag = true;
   bool remove_duplicate_interactions = false;
@@ -260,6 +270,9 @@ struct system_parameters {
   int species_insertion_reattempt_threshold = 10;
   bool uniform_crystal = false;
   int n_steps_equil = 0;
+  bool frame_parallel_analysis = false;
+  bool insitu_analysis = false;
+  bool async_insitu_analysis = false;
   int n_steps_target = 100000;
   bool static_particle_number = false;
   bool checkpoint_from_spec = false;
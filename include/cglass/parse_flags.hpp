@@ -26,6 +26,13 @@ struct run_options {
   bool with_reloads = false;
   bool single_frame = false;
   bool convert = false;
+  bool columns = false;
+  bool frames_flag = false;
+  int frame_start = 0;
+  int frame_stop = -1; // -1: through the last frame
+  int frame_stride = 1;
+  int n_jobs = 1;
+  std::string exe_name;
   std::string param_file;
   std::string run_name = "sc";
 };
@@ -35,7 +42,7 @@ struct run_options {
    string array below when adding new flags. */
 
 // Define flags here
-static const int n_flags = 16;
+static const int n_flags = 19;
 static struct option long_options[] = {{"help", no_argument, 0, 'h'},
                                        {"version", no_argument, 0, 'v'},
                                        {"debug", no_argument, 0, 'd'},
@@ -52,6 +59,9 @@ static struct option long_options[] = {{"help", no_argument, 0, 'h'},
                                        {"with-reloads", no_argument, 0, 'w'},
                                        {"single-frame", no_argument, 0, 'M'},
                                        {"convert", no_argument, 0, 'c'},
+                                       {"frames", required_argument, 0, 'f'},
+                                       {"jobs", required_argument, 0, 'j'},
+                                       {"columns", no_argument, 0, 'C'},
                                        {0, 0, 0, 0}};
 
 // Descriptions for flags
@@ -86,7 +96,14 @@ static const std::string desc[n_flags][2] = {
      "system state",
      "none"},
     {"converts posit and spec files to text files",
-     "none"}};
+     "none"},
+    {"only process output frames start to stop (exclusive) every stride "
+     "frames, using frame index files. Any field may be left empty",
+     "start:stop:stride"},
+    {"run up to njobs simulations of a batch at a time as separate processes, "
+     "resuming any that were interrupted from their checkpoints",
+     "njobs"},
+    {"exports spec files to columnar .npy files, one per field", "none"}};
 
 /*************************
    SHOW_HELP_INFO
@@ -115,6 +132,29 @@ static void show_version_info() {
   std::cout << "C-GLASS version no. " << cglass_version << "\n";
 }
 
+/* Parse a frame range of the form start:stop:stride, where any of the fields
+   may be empty */
+static bool parse_frame_range(std::string range, run_options &run_opts) {
+  std::string fields[3];
+  int n_fields = 0;
+  size_t pos;
+  while ((pos = range.find(':')) != std::string::npos && n_fields < 2) {
+    fields[n_fields++] = range.substr(0, pos);
+    range.erase(0, pos + 1);
+  }
+  fields[n_fields] = range;
+  if (range.find(':') != std::string::npos) {
+    return false;
+  }
+  if (!fields[0].empty())
+    run_opts.frame_start = atoi(fields[0].c_str());
+  if (!fields[1].empty())
+    run_opts.frame_stop = atoi(fields[1].c_str());
+  if (!fields[2].empty())
+    run_opts.frame_stride = atoi(fields[2].c_str());
+  return (run_opts.frame_start >= 0 && run_opts.frame_stride > 0);
+}
+
 /*************************
    PARSE_OPTS
     New flag switches should be added below, as well as any information that
@@ -129,10 +169,11 @@ static run_options parse_opts(int argc, char *argv[]) {
   }
 
   run_options run_opts;
+  run_opts.exe_name = argv[0];
   int tmp;
   while (1) {
     int option_index = 0;
-    tmp = getopt_long(argc, argv, "hvdmaplwbMGcg:r:n:R:", long_options,
+    tmp = getopt_long(argc, argv, "hvdmaplwbMGcCg:r:n:R:f:j:", long_options,
                       &option_index);
     if (tmp == -1)
       break;
@@ -193,6 +234,23 @@ static run_options parse_opts(int argc, char *argv[]) {
     case 'c':
       run_opts.convert = true;
       break;
+    case 'C':
+      run_opts.columns = true;
+      break;
+    case 'f':
+      run_opts.frames_flag = true;
+      if (!parse_frame_range(optarg, run_opts)) {
+        std::cout << "  ERROR: Invalid frame range: " << optarg << "\n";
+        exit(1);
+      }
+      break;
+    case 'j':
+      run_opts.n_jobs = atoi(optarg);
+      if (run_opts.n_jobs < 1) {
+        std::cout << "  ERROR: Invalid number of jobs: " << optarg << "\n";
+        exit(1);
+      }
+      break;
     case '?':
       exit(1);
     default:
@@ -248,6 +306,21 @@ static run_options parse_opts(int argc, char *argv[]) {
   if (run_opts.convert) {
     printf("Converting spec/posit files to text files.\n");
   }
+  if (run_opts.columns) {
+    printf("  Exporting spec files to columnar .npy files\n");
+  }
+  if (run_opts.frames_flag) {
+    printf("  Processing frames %d to ", run_opts.frame_start);
+    if (run_opts.frame_stop < 0) {
+      printf("end");
+    } else {
+      printf("%d", run_opts.frame_stop);
+    }
+    printf(" with stride %d\n", run_opts.frame_stride);
+  }
+  if (run_opts.n_jobs > 1) {
+    printf("  Running up to %d simulations at a time\n", run_opts.n_jobs);
+  }
   return run_opts;
 }
 
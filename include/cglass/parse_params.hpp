@@ -56,6 +56,8 @@ system_parameters parse_system_params(YAML::Node &node) {
     params.load_checkpoint = it->second.as<bool>();
     } else if (param_name.compare("checkpoint_run_name")==0) {
     params.checkpoint_run_name = it->second.as<std::string>();
+    } else if (param_name.compare("checkpoint_step")==0) {
+    params.checkpoint_step = it->second.as<int>();
     } else if (param_name.compare("n_load")==0) {
     params.n_load = it->second.as<int>();
     } else if (param_name.compare("movie_flag")==0) {
@@ -100,6 +102,16 @@ system_parameters parse_system_params(YAML::Node &node) {
     params.thermo_flag = it->second.as<bool>();
     } else if (param_name.compare("n_thermo")==0) {
     params.n_thermo = it->second.as<int>();
+    } else if (param_name.compare("async_output")==0) {
+    params.async_output = it->second.as<bool>();
+    } else if (param_name.compare("output_queue_size")==0) {
+    params.output_queue_size = it->second.as<int>();
+    } else if (param_name.compare("compact_output")==0) {
+    params.compact_output = it->second.as<bool>();
+    } else if (param_name.compare("compact_precision")==0) {
+    params.compact_precision = it->second.as<double>();
+    } else if (param_name.compare("compact_keyframe_interval")==0) {
+    params.compact_keyframe_interval = it->second.as<int>();
     } else if (param_name.compare("insert_radius")==0) {
     params.insert_radius = it->second.as<double>();
     } else if (param_name.compare("interaction_flag")==0) {
@@ -118,6 +130,12 @@ system_parameters parse_system_params(YAML::Node &node) {
     params.uniform_crystal = it->second.as<bool>();
     } else if (param_name.compare("n_steps_equil")==0) {
     params.n_steps_equil = it->second.as<int>();
+    } else if (param_name.compare("frame_parallel_analysis")==0) {
+    params.frame_parallel_analysis = it->second.as<bool>();
+    } else if (param_name.compare("insitu_analysis")==0) {
+    params.insitu_analysis = it->second.as<bool>();
+    } else if (param_name.compare("async_insitu_analysis")==0) {
+    params.async_insitu_analysis = it->second.as<bool>();
     } else if (param_name.compare("n_steps_target")==0) {
     params.n_steps_target = it->second.as<int>();
     } else if (param_name.compare("static_particle_number")==0) {
@@ -405,6 +423,12 @@ species_base_parameters *parse_species_params(std::string sid,
       params.in_out_analysis = jt->second.as<bool>();
       } else if (param_name.compare("drive_from_bond_center")==0) {
       params.drive_from_bond_center = jt->second.as<bool>();
+      } else if (param_name.compare("n_respa")==0) {
+      params.n_respa = jt->second.as<int>();
+      } else if (param_name.compare("implicit_bending")==0) {
+      params.implicit_bending = jt->second.as<bool>();
+      } else if (param_name.compare("fused_integrator")==0) {
+      params.fused_integrator = jt->second.as<bool>();
       } else if (param_name.compare("flagella_flag")==0) {
       params.flagella_flag = jt->second.as<bool>();
       } else if (param_name.compare("flagella_freq")==0) {
@@ -699,6 +723,8 @@ species_base_parameters *parse_species_params(std::string sid,
       params.r_capture = jt->second.as<double>();
       } else if (param_name.compare("lut_grid_num")==0) {
       params.lut_grid_num = jt->second.as<int>();
+      } else if (param_name.compare("event_driven_kinetics")==0) {
+      params.event_driven_kinetics = jt->second.as<bool>();
       } else if (param_name.compare("anchors")==0) {
         for (size_t i = 0; i < jt->second.size(); ++i) {
           if (i > 1) {
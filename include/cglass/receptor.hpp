@@ -45,12 +45,13 @@ public:
   void SubTorque(const double *const torque);
 
   // Read/write binaries
-  void WriteSpec(std::fstream &ospec);
-  void ReadSpec(std::fstream &ispec);
+  void WriteSpec(FrameBuffer &ospec);
+  void ReadSpec(FrameReader &ispec);
 
   // Convert binary data to text. Static to avoid needing to istantiate
   // species members.
-  static void ConvertSpec(std::fstream &ispec, std::fstream &otext);
+  static void ConvertSpec(FrameReader &ispec, std::fstream &otext);
+  static void ExportSpec(FrameReader &ispec, ColumnFrame &columns);
   static void WriteSpecTextHeader(std::fstream &otext);
 };
 
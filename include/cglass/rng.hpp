@@ -14,8 +14,15 @@ class RNG {
   ~RNG();
   RNG(const RNG &that) : RNG(that.GetSeed()) {}
   RNG &operator=(RNG const &that) { return *this; }
+  /* Moving transfers the generator state without allocating a new one */
+  RNG(RNG &&that) noexcept : rng_(that.rng_) { that.rng_ = nullptr; }
+  RNG &operator=(RNG &&that) noexcept {
+    std::swap(rng_, that.rng_);
+    return *this;
+  }
   const double RandomUniform();
   const int RandomPoisson(const double mean);
+  const double RandomExponential(const double mean);
   const long RandomInt(const long n);
   const double RandomNormal(const double sigma);
   void RandomUnitVector(const int n_dim, double *vec);
@@ -15,6 +15,12 @@ class Simulation {
   int log_interval_ = 10;
   int n_steps_;
   int frame_num_ = 0;
+  // Steps visited by RunProcessing
+  int frame_initial_step_ = 0; // step of the frame read before processing
+  int frame_first_step_ = 1;
+  int frame_last_step_ = 0; // n_steps * inv_step_fact_ if not set
+  int frame_step_stride_ = 1;
+  bool frame_parallel_ = false; // run analyses with RunFrameParallelAnalysis
   double time_;
   double cpu_init_time_;
   std::string run_name_;
@@ -52,6 +58,9 @@ class Simulation {
   void ReadSpeciesPositions();
   void ZeroForces();
   void Statistics();
+  void InitInsituAnalysis();
+  void RunInsituAnalysis();
+  void FinalizeInsituAnalysis();
   void ScaleSpeciesPositions();
   std::vector<graph_struct *> graph_array_;
   void PrintComplete();
@@ -59,6 +68,9 @@ class Simulation {
   void RunProcessing(run_options run_opts);
   void InitGraphics();
   void InitProcessing(run_options run_opts);
+  void InitFrameRange(run_options run_opts);
+  void InitFrameParallelAnalysis(run_options run_opts);
+  void RunFrameParallelAnalysis(run_options run_opts);
 
  public:
   Simulation() {}
@@ -1,6 +1,7 @@
 #ifndef _CGLASS_SIMULATION_MANAGER_H_
 #define _CGLASS_SIMULATION_MANAGER_H_
 
+#include "job_runner.hpp"
 #include "simulation.hpp"
 
 class SimulationManager {
@@ -28,6 +28,9 @@ class Site : public Sphere {
   Bond* GetOtherBond(int bond_oid);
   void CalcTangent();
   void SetRandomForce(double* f_rand);
+  void SetTangent(double const* const utan) {
+    std::copy(utan, utan + 3, tangent_);
+  }
   void AddRandomForce();
   double const* const GetRandomForce();
   double const* const GetTangent();
@@ -37,8 +40,8 @@ class Site : public Sphere {
   void RemoveOutgoingBonds();
   void RemoveBond(int bond_oid);
   virtual bool HasNeighbor(int other_oid);
-  void WriteSpec(std::fstream &op);
-  void ReadSpec(std::fstream &ip);
+  void WriteSpec(FrameBuffer &op);
+  void ReadSpec(FrameReader &ip);
   void SetTheta(const double theta) { theta_ = theta; }
   void SetPhi(const double phi) { phi_ = phi; }
   Object *GetMeshPtr() { return mesh_ptr_; }
@@ -49,7 +52,8 @@ class Site : public Sphere {
 
   // Convert binary data to text. Static to avoid needing to istantiate
   // species members.
-  static void ConvertSpec(std::fstream &ispec, std::fstream &otext);
+  static void ConvertSpec(FrameReader &ispec, std::fstream &otext);
+  static void ExportSpec(FrameReader &ispec, ColumnFrame &columns);
   static void WriteSpecTextHeader(std::fstream &otext);
 };
 
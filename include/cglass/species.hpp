@@ -3,6 +3,7 @@
 
 #include "species_base.hpp"
 #include <stdexcept>
+#include <thread>
 #ifdef ENABLE_OPENMP
 #include "omp.h"
 #endif
@@ -12,15 +13,28 @@ template <typename T, unsigned char S> class Species : public SpeciesBase {
 private:
   // Check if input spec file is valid/not at eof
   bool CheckISpec();
+  void ReadFrame(FrameReader &in, std::vector<T> &members, bool read_posits,
+                 bool draw_seeds = true);
+  bool ReadColumnFrame(FrameReader &in, ColumnFrame &frame, int &n_members);
+  void SnapshotMembers();
 protected:
   std::vector<T> members_;
   species_parameters<S> sparams_;
   std::vector<Analysis<T, S> *> analysis_;
+  /* Asynchronous in-situ analyses run on a snapshot of the members on
+     analysis_thread_ while the simulation continues */
+  bool async_analysis_ = false;
+  std::vector<T> analysis_members_;
+  FrameBuffer analysis_frame_;
+  std::thread analysis_thread_;
   // A pointcover associated with the species members (a mesh that surrounds objects)
   PointCover* pc_ = nullptr;
   virtual void LoadAnalysis() {
     /* Check parameters for analyses and load them into analysis_ here */
   }
+  /* Species-level state written at the end of a checkpoint, after members */
+  virtual void WriteCheckpointState(FrameBuffer &ocheck) {}
+  virtual void ReadCheckpointState(FrameReader &icheck) {}
 
 public:
   Species(unsigned long seed) : SpeciesBase(seed) {
@@ -28,6 +42,9 @@ public:
   }
   // Free dynamically allocated PointCover
   ~Species() {
+    if (analysis_thread_.joinable()) {
+      analysis_thread_.join();
+    }
     delete pc_;
   }
   // Initialize function for setting it up on the first pass
@@ -78,6 +95,8 @@ public:
   virtual void Draw(std::vector<graph_struct *> &graph_array);
   virtual void UpdatePositions();
   virtual void GetInteractors(std::vector<Object *> &ix);
+  virtual void GetInteractorUpdates(std::vector<Object *> &added,
+                                    std::vector<Object *> &removed);
   virtual void GetLastInteractors(std::vector<Object *> &ix);
   virtual double GetPotentialEnergy();
   virtual void ZeroForces();
@@ -91,6 +110,7 @@ public:
   virtual void ReadSpecs();
   virtual void ReadCheckpoints();
   virtual void ConvertSpecs(double time);
+  virtual void ExportColumns(std::string run_name);
   virtual void ScalePositions();
   virtual const std::vector<T> &GetMembers() { return members_; }
   virtual void CleanUp();
@@ -112,7 +132,12 @@ public:
       (*it)->Run();
     }
   }
+  virtual void InitInsituAnalysis(bool async);
+  virtual void RunInsituAnalysis(int i_step);
   virtual void FinalizeAnalysis() {
+    if (analysis_thread_.joinable()) {
+      analysis_thread_.join();
+    }
     for (auto it = analysis_.begin(); it != analysis_.end(); ++it) {
       (*it)->End();
       delete (*it);
@@ -126,6 +151,10 @@ public:
     }
     return false;
   }
+  virtual bool CanRunFrameParallelAnalysis(bool posits_only);
+  virtual void RunFrameParallelAnalysis(int initial_step, int first_step,
+                                        int last_step, int step_stride,
+                                        bool posits_only);
 };
 
 template <typename T, unsigned char S> double const Species<T, S>::GetVolume() {
@@ -147,7 +176,7 @@ template <typename T, unsigned char S> void Species<T, S>::AddMember() {
   Logger::Trace("Adding member to %s %s, member number %d, member id %d",
                 GetSID()._to_string(), GetSpeciesName().c_str(), n_members_ + 1,
                 newmember.GetOID());
-  members_.push_back(newmember);
+  members_.push_back(std::move(newmember));
   members_.back().SetSID(GetSID());
   members_.back().Init(&sparams_);
   n_members_++;
@@ -196,8 +225,8 @@ void Species<T, S>::ResetPreviousPositions() {
 template <typename T, unsigned char S> void Species<T, S>::AddMember(T newmem) {
   Logger::Trace("Adding preexisting member to %s %s", GetSID()._to_string(),
                 GetSpeciesName().c_str());
-  members_.push_back(newmem);
-  newmem.SetSID(GetSID());
+  members_.push_back(std::move(newmem));
+  members_.back().SetSID(GetSID());
   n_members_++;
 }
 
@@ -238,6 +267,14 @@ void Species<T, S>::GetInteractors(std::vector<Object *> &ixors) {
   }
 }
 
+template <typename T, unsigned char S>
+void Species<T, S>::GetInteractorUpdates(std::vector<Object *> &added,
+                                         std::vector<Object *> &removed) {
+  for (auto it = members_.begin(); it != members_.end(); ++it) {
+    it->GetInteractorUpdates(added, removed);
+  }
+}
+
 template <typename T, unsigned char S>
 void Species<T, S>::GetLastInteractors(std::vector<Object *> &ix) {
   if (members_.size() == 0) {
@@ -280,40 +317,44 @@ template <typename T, unsigned char S> int Species<T, S>::GetCount() {
   return count;
 }
 
+/* Frames are serialized into a buffer and written with a single call */
 template <typename T, unsigned char S> void Species<T, S>::WritePosits() {
   int size = members_.size();
-  oposit_file_.write(reinterpret_cast<char *>(&size), sizeof(int));
+  oframe_.write(reinterpret_cast<char *>(&size), sizeof(int));
   for (auto it = members_.begin(); it != members_.end(); ++it)
-    it->WritePosit(oposit_file_);
+    it->WritePosit(oframe_);
+  CompressFrame(posit_encoder_, posit_offset_);
+  IndexFrame(oposit_index_file_, posit_offset_, size);
+  CommitFrame(oposit_file_);
 }
 
 template <typename T, unsigned char S> void Species<T, S>::WriteSpecs() {
   int size = members_.size();
-  ospec_file_.write(reinterpret_cast<char *>(&size), sizeof(int));
+  oframe_.write(reinterpret_cast<char *>(&size), sizeof(int));
   for (auto it = members_.begin(); it != members_.end(); ++it)
-    it->WriteSpec(ospec_file_);
+    it->WriteSpec(oframe_);
+  CompressFrame(spec_encoder_, spec_offset_);
+  IndexFrame(ospec_index_file_, spec_offset_, size);
+  CommitFrame(ospec_file_);
 }
 
 template <typename T, unsigned char S> void Species<T, S>::WriteCheckpoints() {
   Logger::Trace("Writing checkpoints for %s %s", GetSID()._to_string(),
                 GetSpeciesName().c_str());
-  std::fstream ocheck_file(checkpoint_file_, std::ios::out | std::ios::binary);
-  if (!ocheck_file.is_open()) {
-    Logger::Error("Output %s file did not open", checkpoint_file_.c_str());
-  }
   void *rng_state = rng_.GetState();
   size_t rng_size = rng_.GetSize();
   int next_oid = Object::GetNextOID();
   int size = members_.size();
-  ocheck_file.write(reinterpret_cast<char *>(&rng_size), sizeof(size_t));
-  ocheck_file.write(reinterpret_cast<char *>(rng_state), rng_size);
-  ocheck_file.write(reinterpret_cast<char *>(&next_oid), sizeof(int));
-  ocheck_file.write(reinterpret_cast<char *>(&size), sizeof(int));
+  oframe_.write(reinterpret_cast<char *>(&rng_size), sizeof(size_t));
+  oframe_.write(reinterpret_cast<char *>(rng_state), rng_size);
+  oframe_.write(reinterpret_cast<char *>(&next_oid), sizeof(int));
+  oframe_.write(reinterpret_cast<char *>(&size), sizeof(int));
   if (size > 0) {
     for (auto it = members_.begin(); it != members_.end(); ++it)
-      it->WriteCheckpoint(ocheck_file);
+      it->WriteCheckpoint(oframe_);
   }
-  ocheck_file.close();
+  WriteCheckpointState(oframe_);
+  CommitFrame(checkpoint_file_);
 }
 
 template <typename T, unsigned char S> void Species<T, S>::ReadPosits() {
@@ -335,11 +376,14 @@ template <typename T, unsigned char S> void Species<T, S>::ReadPosits() {
     early_exit = true;
     return;
   }
-  if (size != n_members_) {
+  if (size < (int)members_.size()) {
+    members_.erase(members_.begin() + size, members_.end());
+  } else if (size > (int)members_.size()) {
+    /* Only build a template member if new members are needed */
     T member(rng_.GetSeed());
     members_.resize(size, member);
-    n_members_ = size;
   }
+  n_members_ = size;
   for (auto it = members_.begin(); it != members_.end(); ++it)
     it->ReadPosit(iposit_file_);
 }
@@ -355,7 +399,8 @@ void Species<T, S>::ReadPositsFromSpecs() {
 template <typename T, unsigned char S> void Species<T, S>::ReadCheckpoints() {
   Logger::Trace("Reading checkpoints for %s %s", GetSID()._to_string(),
                 GetSpeciesName().c_str());
-  std::fstream icheck_file(checkpoint_file_, std::ios::in | std::ios::binary);
+  FrameReader icheck_file;
+  icheck_file.open(checkpoint_file_);
   if (!icheck_file.is_open()) {
     Logger::Error("Output %s file did not open", checkpoint_file_.c_str());
   }
@@ -378,10 +423,164 @@ template <typename T, unsigned char S> void Species<T, S>::ReadCheckpoints() {
     for (auto it = members_.begin(); it != members_.end(); ++it)
       it->ReadCheckpoint(icheck_file);
   }
+  ReadCheckpointState(icheck_file);
   icheck_file.close();
   Object::SetNextOID(next_oid);
 }
 
+/* Read one frame from in into members, without the end-of-file handling of
+   ReadSpecs and ReadPosits. Safe to call concurrently on separate members.
+   Without draw_seeds, new members are not seeded from the species RNG, which
+   leaves the random number stream of a running simulation untouched. */
+template <typename T, unsigned char S>
+void Species<T, S>::ReadFrame(FrameReader &in, std::vector<T> &members,
+                              bool read_posits, bool draw_seeds) {
+  int size = 0;
+  in.read(reinterpret_cast<char *>(&size), sizeof(int));
+  if (size < (int)members.size()) {
+    members.erase(members.begin() + size, members.end());
+  } else if (size > (int)members.size()) {
+    /* Members are built in place, as in AddMember, since copies of a mesh
+       still point to the sites of the original */
+    if (size > (int)members.capacity()) {
+      members.clear();
+      members.reserve(size);
+    }
+#ifdef ENABLE_OPENMP
+#pragma omp critical
+#endif
+    while ((int)members.size() < size) {
+      members.push_back(T(draw_seeds ? rng_.GetSeed() : members.size() + 1));
+      if (!read_posits) {
+        members.back().SetSID(GetSID());
+        members.back().Init(&sparams_);
+      }
+    }
+  }
+  for (auto it = members.begin(); it != members.end(); ++it) {
+    if (read_posits) {
+      it->ReadPosit(in);
+    } else {
+      it->ReadSpec(in);
+    }
+  }
+}
+
+/* Analyses can run frame-parallel if they all support it and the input file
+   they are read from has a frame index */
+template <typename T, unsigned char S>
+bool Species<T, S>::CanRunFrameParallelAnalysis(bool posits_only) {
+  if (analysis_.empty()) {
+    return true;
+  }
+  bool read_posits = posits_only && GetPositFlag();
+  if (!read_posits && !GetSpecFlag()) {
+    return false;
+  }
+  if (!HasFrameIndex(read_posits)) {
+    return false;
+  }
+  for (auto it = analysis_.begin(); it != analysis_.end(); ++it) {
+    if (!(*it)->IsFrameParallel()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/* Run the analyses over the frames RunProcessing would visit, with the same
+   results. Frames are mapped in batches by worker threads, each with its own
+   members and map of the input file, and reduced in frame order. */
+template <typename T, unsigned char S>
+void Species<T, S>::RunFrameParallelAnalysis(int initial_step, int first_step,
+                                             int last_step, int step_stride,
+                                             bool posits_only) {
+  if (analysis_.empty()) {
+    return;
+  }
+  bool read_posits = posits_only && GetPositFlag();
+  std::vector<frame_index_entry> const &index =
+      (read_posits ? posit_index_ : spec_index_);
+  int inv_step_fact = params_->no_midstep ? 1 : 2;
+  int n_frame_steps = inv_step_fact * (read_posits ? GetNPosit() : GetNSpec());
+  /* On each analysis step, the loaded frame is the one read on the previous
+     frame step that was visited, or the frame read on initial_step */
+  std::vector<std::pair<int, int> > frames; // (step, frame)
+  int i_frame = 0;
+  if (initial_step % n_frame_steps == 0) {
+    i_frame = initial_step / n_frame_steps;
+  }
+  for (int i_step = first_step; i_step <= last_step; i_step += step_stride) {
+    if (i_step % n_frame_steps != 0) {
+      continue;
+    }
+    if (i_frame >= (int)index.size()) {
+      break;
+    }
+    if (i_step >= inv_step_fact * params_->n_steps_equil) {
+      frames.push_back(std::make_pair(i_step, i_frame));
+    }
+    i_frame = i_step / n_frame_steps;
+  }
+  Logger::Info("Running %s %s analyses on %d frames in parallel",
+               GetSID()._to_string(), GetSpeciesName().c_str(),
+               (int)frames.size());
+  int n_threads = 1;
+#ifdef ENABLE_OPENMP
+  n_threads = omp_get_max_threads();
+#endif
+  std::vector<std::vector<T> > worker_members(n_threads);
+  std::vector<FrameReader> worker_input(n_threads);
+  for (auto it = worker_input.begin(); it != worker_input.end(); ++it) {
+    it->open(read_posits ? iposit_file_name_ : ispec_file_name_);
+    if (!it->is_open()) {
+      Logger::Error("Input file for %s %s did not open", GetSID()._to_string(),
+                    GetSpeciesName().c_str());
+    }
+  }
+  int n_analysis = analysis_.size();
+  int batch_size = 16 * n_threads;
+  std::vector<analysis_frame> results(batch_size * n_analysis);
+  int n_frames = frames.size();
+  for (int i_batch = 0; i_batch < n_frames; i_batch += batch_size) {
+    int n_batch = std::min(batch_size, n_frames - i_batch);
+#ifdef ENABLE_OPENMP
+#pragma omp parallel
+#endif
+    {
+      int i_thread = 0;
+#ifdef ENABLE_OPENMP
+      i_thread = omp_get_thread_num();
+#pragma omp for schedule(static)
+#endif
+      for (int i = 0; i < n_batch; ++i) {
+        FrameReader &in = worker_input[i_thread];
+        std::vector<T> &members = worker_members[i_thread];
+        in.clear();
+        in.seekg(index[frames[i_batch + i].second].offset);
+        ReadFrame(in, members, read_posits);
+        if (posits_only && !read_posits) {
+          for (auto it = members.begin(); it != members.end(); ++it) {
+            it->SetAvgPosition();
+          }
+        }
+        for (int j = 0; j < n_analysis; ++j) {
+          analysis_[j]->Map(members, frames[i_batch + i].first,
+                            results[i * n_analysis + j]);
+        }
+      }
+    }
+    for (int i = 0; i < n_batch; ++i) {
+      for (int j = 0; j < n_analysis; ++j) {
+        analysis_frame &result = results[i * n_analysis + j];
+        analysis_[j]->Reduce(frames[i_batch + i].first, result);
+        result.output.clear();
+        result.counts.clear();
+      }
+    }
+  }
+}
+
 // Check if ispec is open and not at end-of-file
 template <typename T, unsigned char S> bool Species<T, S>::CheckISpec() {
   if (ispec_file_.eof()) {
@@ -418,7 +617,10 @@ template <typename T, unsigned char S> void Species<T, S>::ReadSpecs() {
       return;
     }
   }
-  if (n_members_ != members_.size()) {
+  if (n_members_ < (int)members_.size()) {
+    members_.erase(members_.begin() + n_members_, members_.end());
+  } else if (n_members_ > (int)members_.size()) {
+    /* Only build a template member if new members are needed */
     T member(rng_.GetSeed());
     member.Init(&sparams_);
     member.SetSID(GetSID());
@@ -458,6 +660,171 @@ template <typename T, unsigned char S> void Species<T, S>::ConvertSpecs(double t
   }
 }
 
+/* Copy the members to analysis_members_ through their spec output, since
+   copies of a mesh still point to the sites of the original */
+template <typename T, unsigned char S> void Species<T, S>::SnapshotMembers() {
+  analysis_frame_.Clear();
+  int size = members_.size();
+  analysis_frame_.write(reinterpret_cast<char *>(&size), sizeof(int));
+  for (auto it = members_.begin(); it != members_.end(); ++it) {
+    it->WriteSpec(analysis_frame_);
+  }
+  FrameReader in;
+  in.open(analysis_frame_.Data(), analysis_frame_.Size());
+  /* Snapshot members are not part of the simulation, so building them must
+     not use up object IDs, which would change the OIDs of later objects and
+     the next OID stored in checkpoints */
+  int next_oid = Object::GetNextOID();
+  ReadFrame(in, analysis_members_, false, false);
+  Object::SetNextOID(next_oid);
+}
+
+/* Attach the analyses to the live members, or to a snapshot of them if they
+   run asynchronously. Analyses that use interactions read them from the
+   members, so they always run on the live members. */
+template <typename T, unsigned char S>
+void Species<T, S>::InitInsituAnalysis(bool async) {
+  LoadAnalysis();
+  async_analysis_ = async && !analysis_.empty() && !CheckInteractionAnalysis();
+  if (async && !analysis_.empty() && !async_analysis_) {
+    Logger::Warning("%s %s analyses require interactions and cannot run "
+                    "asynchronously", GetSID()._to_string(),
+                    GetSpeciesName().c_str());
+  }
+  if (async_analysis_) {
+    SnapshotMembers();
+  }
+  for (auto it = analysis_.begin(); it != analysis_.end(); ++it) {
+    (*it)->Init(async_analysis_ ? analysis_members_ : members_, sparams_);
+  }
+}
+
+/* Analyze the current configuration as the frame of step i_step. An
+   asynchronous run first waits for the previous one, so at most one snapshot
+   is analyzed at a time and frames are analyzed in order. */
+template <typename T, unsigned char S>
+void Species<T, S>::RunInsituAnalysis(int i_step) {
+  if (analysis_.empty()) {
+    return;
+  }
+  if (!async_analysis_) {
+    for (auto it = analysis_.begin(); it != analysis_.end(); ++it) {
+      (*it)->RunAt(i_step);
+    }
+    return;
+  }
+  if (analysis_thread_.joinable()) {
+    analysis_thread_.join();
+  }
+  SnapshotMembers();
+  analysis_thread_ = std::thread([this, i_step]() {
+    for (auto it = analysis_.begin(); it != analysis_.end(); ++it) {
+      (*it)->RunAt(i_step);
+    }
+  });
+}
+
+/* Read the next spec frame into frame. Returns false at the end of the file or
+   at an incomplete frame. */
+template <typename T, unsigned char S>
+bool Species<T, S>::ReadColumnFrame(FrameReader &in, ColumnFrame &frame,
+                                    int &n_members) {
+  frame.Clear();
+  n_members = -1;
+  in.read(reinterpret_cast<char *>(&n_members), sizeof(int));
+  if (in.eof() || n_members < 0) {
+    return false;
+  }
+  for (int i = 0; i < n_members; ++i) {
+    T::ExportSpec(in, frame);
+  }
+  return !in.eof();
+}
+
+/* Export the spec file to <run_name>_<sid>_<name>_columns, with one .npy file
+   per field (see ColumnWriter). With a frame index, frames are decoded by
+   worker threads in batches, each with its own map of the spec file, and
+   appended in frame order. */
+template <typename T, unsigned char S>
+void Species<T, S>::ExportColumns(std::string run_name) {
+  if (!GetSpecFlag() || !GetSpecValid()) {
+    return;
+  }
+  std::string dir = run_name + "_" + GetSID()._to_string() + "_" +
+                    GetSpeciesName() + "_columns";
+  ColumnWriter writer;
+  if (!writer.Open(dir)) {
+    Logger::Warning("Column directory %s could not be created", dir.c_str());
+    return;
+  }
+  Logger::Info("Exporting %s %s specs to %s", GetSID()._to_string(),
+               GetSpeciesName().c_str(), dir.c_str());
+  double step_time = params_->delta * (params_->no_midstep ? 1 : 0.5);
+  int n_frame_steps = (params_->no_midstep ? 1 : 2) * GetNSpec();
+  int n_frames = 0;
+  int n_members = 0;
+  if (!spec_indexed_) {
+    ColumnFrame frame;
+    /* Spec frames are not written on step 0, so frame k is from step
+       (k + 1) * n_spec, as in ConvertSpecs */
+    while (ReadColumnFrame(ispec_file_, frame, n_members)) {
+      int step = (n_frames + 1) * n_frame_steps;
+      writer.Append(frame, step, step * step_time, n_members);
+      n_frames++;
+    }
+  } else {
+    int n_threads = 1;
+#ifdef ENABLE_OPENMP
+    n_threads = omp_get_max_threads();
+#endif
+    std::vector<FrameReader> worker_input(n_threads);
+    for (auto it = worker_input.begin(); it != worker_input.end(); ++it) {
+      it->open(ispec_file_name_);
+      if (!it->is_open()) {
+        Logger::Error("Input file for %s %s did not open",
+                      GetSID()._to_string(), GetSpeciesName().c_str());
+      }
+    }
+    int n_index = spec_index_.size();
+    int batch_size = 16 * n_threads;
+    std::vector<ColumnFrame> frames(batch_size);
+    std::vector<int> frame_members(batch_size);
+    std::vector<char> complete(batch_size);
+    bool done = false;
+    for (int i_batch = 0; i_batch < n_index && !done; i_batch += batch_size) {
+      int n_batch = std::min(batch_size, n_index - i_batch);
+#ifdef ENABLE_OPENMP
+#pragma omp parallel
+#endif
+      {
+        int i_thread = 0;
+#ifdef ENABLE_OPENMP
+        i_thread = omp_get_thread_num();
+#pragma omp for schedule(static)
+#endif
+        for (int i = 0; i < n_batch; ++i) {
+          FrameReader &in = worker_input[i_thread];
+          in.clear();
+          in.seekg(spec_index_[i_batch + i].offset);
+          complete[i] = ReadColumnFrame(in, frames[i], frame_members[i]);
+        }
+      }
+      for (int i = 0; i < n_batch; ++i) {
+        if (!complete[i]) {
+          done = true;
+          break;
+        }
+        int step = spec_index_[i_batch + i].step;
+        writer.Append(frames[i], step, step * step_time, frame_members[i]);
+        n_frames++;
+      }
+    }
+  }
+  writer.Close();
+  Logger::Info("Exported %d frames of %s %s", n_frames, GetSID()._to_string(),
+               GetSpeciesName().c_str());
+}
+
 template <typename T, unsigned char S> void Species<T, S>::ScalePositions() {
   for (auto it = members_.begin(); it != members_.end(); ++it)
     it->ScalePosition();
@@ -1,9 +1,12 @@
 #ifndef _CGLASS_SPECIES_BASE_H_
 #define _CGLASS_SPECIES_BASE_H_
 
+#include "async_writer.hpp"
+#include "frame_index.hpp"
 #include "object.hpp"
 #include "params_parser.hpp"
 #include "point_cover.hpp"
+#include "trajectory_codec.hpp"
 #include "cortex.hpp"
 
 class SpeciesBase {
@@ -18,12 +21,36 @@ protected:
   static const SpaceBase *space_;
   RNG rng_;
   std::fstream oposit_file_;
-  std::fstream iposit_file_;
+  FrameReader iposit_file_; // mapped posit input
   std::fstream ospec_text_file_;
   std::fstream ospec_file_;
-  std::fstream ispec_file_;
+  FrameBuffer oframe_; // reused for every posit and spec frame
+  FrameBuffer oblock_; // compact encoding of oframe_
+  TrajectoryEncoder posit_encoder_; // enabled with compact_output
+  TrajectoryEncoder spec_encoder_;
+  AsyncWriter *writer_ = nullptr; // writes frames off-thread if set
+  std::fstream oposit_index_file_;
+  std::fstream ospec_index_file_;
+  int64_t posit_offset_ = 0; // byte offset of the next posit frame
+  int64_t spec_offset_ = 0;  // byte offset of the next spec frame
+  std::vector<frame_index_entry> posit_index_;
+  std::vector<frame_index_entry> spec_index_;
+  bool posit_indexed_ = false;
+  bool spec_indexed_ = false;
+  std::string iposit_file_name_;
+  std::string ispec_file_name_;
+  FrameReader ispec_file_; // mapped spec input
   std::string checkpoint_file_;
   std::vector<std::string> spec_file_names_;
+  void CommitFrame(std::fstream &ofile);
+  void WriteFileHeader(std::fstream &ofile, TrajectoryEncoder &encoder,
+                       int n_out, int64_t &offset);
+  void CompressFrame(TrajectoryEncoder &encoder, int64_t offset);
+  void IndexFrame(std::fstream &oindex, int64_t &offset, int n_members);
+  void OpenIndexFile(std::fstream &oindex, std::string const &file_name);
+  bool SeekFrame(FrameReader &ifile,
+                 std::vector<frame_index_entry> const &index, int i_frame);
+  void CommitFrame(std::string const &file_name);
 
 public:
   SpeciesBase(unsigned long seed);
@@ -37,6 +64,8 @@ public:
   virtual void InitMembers() {}
   virtual void ZeroForces() {}
   virtual void GetInteractors(std::vector<Object *> &ix) {}
+  virtual void GetInteractorUpdates(std::vector<Object *> &added,
+                                    std::vector<Object *> &removed) {}
   virtual void GetLastInteractors(std::vector<Object *> &ix) {}
   virtual double GetPotentialEnergy() { return 0; }
   virtual void ScalePositions() {}
@@ -75,14 +104,22 @@ public:
   virtual void ReadPosits() {}
   virtual void ReadPositsFromSpecs() {}
   virtual void ConvertSpecs(double) {}
+  virtual void ExportColumns(std::string run_name) {}
   virtual void InitAnalysis() {}
   virtual void RunAnalysis() {}
   virtual void FinalizeAnalysis() {}
+  virtual void InitInsituAnalysis(bool async) {}
+  virtual void RunInsituAnalysis(int i_step) {}
+  virtual bool CanRunFrameParallelAnalysis(bool posits_only) { return true; }
+  virtual void RunFrameParallelAnalysis(int initial_step, int first_step,
+                                        int last_step, int step_stride,
+                                        bool posits_only) {}
   virtual void InitOutputFiles(std::string run_name);
   virtual void InitConvertFiles(std::string run_name);
   virtual void InitPositFile(std::string run_name);
   virtual void InitSpecFile(std::string run_name);
   virtual void InitConvertSpecFile(std::string run_name);
+  virtual void InitColumnFiles(std::string run_name);
   virtual void InitPositFileInput(std::string run_name);
   virtual void InitSpecFileInput(std::string run_name, bool convert);
   virtual bool InitSpecFileInputFromFile(std::string run_name, bool convert);
@@ -95,6 +132,12 @@ public:
   virtual int OutputIsOpen() { return oposit_file_.is_open(); }
   virtual int InputIsOpen() { return iposit_file_.is_open(); }
   virtual void CloseFiles();
+  void SetOutputWriter(AsyncWriter *writer) { writer_ = writer; }
+  bool HasFrameIndex(bool posits) const {
+    return (posits ? posit_indexed_ : spec_indexed_);
+  }
+  bool SeekPositFrame(int i_frame);
+  bool SeekSpecFrame(int i_frame);
   virtual void CleanUp() {}
   virtual void Reserve() {}
   virtual double const GetVolume() { return 0; }
@@ -105,6 +148,8 @@ public:
   virtual void ZeroDrTot() {}
   virtual void CustomInsert() {}
   virtual const bool CheckInteractorUpdate() { return false; }
+  /* Whether interactor lengths/areas can change on any step */
+  virtual const bool CheckInteractorSizeUpdate() { return false; }
   virtual const std::string GetSpeciesName() const { return "base"; }
 };
 
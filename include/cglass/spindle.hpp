@@ -52,14 +52,15 @@ public:
   const double GetDrTot();
   const int GetNFilaments();
   const bool CheckInteractorUpdate();
-  void WriteCheckpoint(std::fstream &ocheck);
-  void WriteSpec(std::fstream &ospec);
-  void ReadCheckpoint(std::fstream &icheck);
-  void ReadSpec(std::fstream &ispec);
+  void WriteCheckpoint(FrameBuffer &ocheck);
+  void WriteSpec(FrameBuffer &ospec);
+  void ReadCheckpoint(FrameReader &icheck);
+  void ReadSpec(FrameReader &ispec);
 
   // Convert binary data to text. Static to avoid needing to istantiate
   // species members.
-  static void ConvertSpec(std::fstream &ispec, std::fstream &otext);
+  static void ConvertSpec(FrameReader &ispec, std::fstream &otext);
+  static void ExportSpec(FrameReader &ispec, ColumnFrame &columns);
   static void WriteSpecTextHeader(std::fstream &otext);
 };
 
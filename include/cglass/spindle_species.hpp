@@ -15,6 +15,9 @@ public:
   void UpdatePositions();
   void AddMember();
   const double GetSpecLength() const;
+  const bool CheckInteractorSizeUpdate() {
+    return fparams_.dynamic_instability_flag;
+  }
   void ReadSpecs();
 };
 
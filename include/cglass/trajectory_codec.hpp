@@ -0,0 +1,79 @@
+#ifndef _CGLASS_TRAJECTORY_CODEC_H_
+#define _CGLASS_TRAJECTORY_CODEC_H_
+
+#include "frame_buffer.hpp"
+#include <cstdint>
+#include <vector>
+
+/* Compact format for posit and spec files (compact_output). The file starts
+   with the magic "CGLSCMP2", the length and unit quantization steps and the
+   keyframe interval, followed by one block per frame (the file header is a
+   block of its own):
+
+   uchar type (0: stored, 1: keyframe, 2: delta frame)
+   uint32 decoded_size
+   uint32 encoded_size
+   int64 keyframe_offset (offset of the keyframe a delta frame builds on)
+   char[encoded_size] payload
+
+   Frames are split into fields by the size and kind of each write (see
+   field_kind). Length fields are quantized to integer multiples of the
+   length step and dimensionless fields of order one, such as orientations,
+   to multiples of the unit step. All other doubles are stored exactly. Each
+   field is stored as the difference to the same field in the previous
+   frame. Keyframes, which also record the field layout, difference
+   against zero and are written every keyframe interval or whenever the
+   layout changes (e.g. members are added or filaments grow). Fields that do
+   not change, such as member diameters and lengths, cost almost nothing
+   after the adaptive range coder that packs the payload. Decoding gives the
+   same frame layout as the uncompressed format. */
+class TrajectoryEncoder {
+private:
+  double quantum_ = 0;
+  double inv_quantum_ = 0;
+  double unit_quantum_ = 0;
+  double inv_unit_quantum_ = 0;
+  int keyframe_interval_ = 1;
+  int since_keyframe_ = 0;
+  int64_t keyframe_offset_ = 0;
+  std::vector<int> layout_;
+  std::vector<int> prev_layout_;
+  std::vector<int64_t> prev_;
+  std::vector<char> payload_;
+  std::vector<uint16_t> models_;
+  void WriteBlock(FrameBuffer &out, unsigned char type, size_t decoded_size);
+
+public:
+  void Init(double quantum, double unit_quantum, int keyframe_interval);
+  bool IsEnabled() const { return quantum_ > 0; }
+  /* Write the file magic followed by header as a stored block */
+  void EncodeHeader(FrameBuffer &header, FrameBuffer &out);
+  /* Encode frame, which starts at offset in the file, as a block in out */
+  void Encode(FrameBuffer &frame, int64_t offset, FrameBuffer &out);
+};
+
+class TrajectoryDecoder {
+private:
+  double quantum_ = 0;
+  double unit_quantum_ = 0;
+  size_t first_block_ = 0;
+  size_t next_offset_ = 0; // offset following the last decoded block
+  std::vector<int> layout_;
+  std::vector<int64_t> prev_;
+  std::vector<char> scratch_;
+  std::vector<uint16_t> models_;
+
+public:
+  static bool IsCompact(const char *data, size_t size);
+  void Init(const char *data);
+  size_t FirstBlock() const { return first_block_; }
+  /* Decode the block at pos into frame and advance pos past it. Returns false
+     at the end of the data or at an incomplete block. */
+  bool Decode(const char *data, size_t size, size_t &pos,
+              std::vector<char> &frame);
+  /* Prepare to decode the block at offset by decoding the frames from its
+     keyframe on, unless they were just decoded */
+  bool Seek(const char *data, size_t size, size_t offset);
+};
+
+#endif
@@ -7,7 +7,7 @@ Anchor::Anchor(unsigned long seed) : Object(seed) {
 void Anchor::Init(crosslink_parameters *sparams, int index) {
   index_ = index;
   sparams_ = sparams;
-  name_ = sparams_->name;
+  SetName(sparams_->name);
   diameter_ = sparams_->diameter;
   color_ = sparams_->anchors[index_].color;
   draw_ = draw_type::_from_string(sparams_->draw_type.c_str());
@@ -33,8 +33,10 @@ void Anchor::Init(crosslink_parameters *sparams, int index) {
   SetDiffusion();
 }
 
-void Anchor::SetBindParamMap(std::vector<std::map<std::string, bind_params> > *bind_param_map) {
+void Anchor::SetBindParamMap(std::vector<std::map<std::string, bind_params> > *bind_param_map,
+                             std::vector<std::vector<bind_params *> > *bind_param_ids) {
   bind_param_map_ = bind_param_map;
+  bind_param_ids_ = bind_param_ids;
 }
 
 double const Anchor::GetMeshLambda() { return mesh_lambda_; }
@@ -51,7 +53,8 @@ void Anchor::SetDiffusion() {
 }
 
 void Anchor::UpdateAnchorPositionToMesh() {
-  if (!bound_ || static_flag_)
+  /* Anchors on a motor track are positioned by the track sweep */
+  if (!bound_ || static_flag_ || on_track_)
     return;
   if (!mesh_) {
     UpdateAnchorPositionToObj();
@@ -77,6 +80,39 @@ void Anchor::UpdateAnchorPositionToMesh() {
   UpdateAnchorPositionToObj();
 }
 
+/* Mesh whose motor track this anchor belongs to, or nullptr if the anchor does
+   not move along a mesh */
+Mesh *Anchor::GetTrackMesh() {
+  if (!bound_ || static_flag_ || !mesh_ || !bond_) {
+    return nullptr;
+  }
+  return mesh_;
+}
+
+/* Same as UpdateAnchorPositionToMesh, but the bond is found by advancing a
+   cursor from the bond of the previous anchor on the track. Anchors on a
+   track are sorted by mesh lambda, so a whole track is resolved in a single
+   pass over the mesh bonds. */
+void Anchor::UpdateAnchorPositionToTrack(int &i_bond) {
+  mesh_length_ = mesh_->GetTrueLength();
+  if (!CheckMesh())
+    return;
+  int n_bonds = mesh_->GetNBonds();
+  if (i_bond >= n_bonds) {
+    i_bond = n_bonds - 1;
+  }
+  while (i_bond + 1 < n_bonds &&
+         mesh_->GetBond(i_bond + 1)->GetMeshLambda() <= mesh_lambda_) {
+    i_bond++;
+  }
+  bond_ = mesh_->GetBond(i_bond);
+  rod_ = bond_;
+  if (!CalcRodLambda()) {
+    return;
+  }
+  UpdateAnchorPositionToObj();
+}
+
 bool Anchor::CalcRodLambda() {
   if (!rod_) {
     Logger::Error("Attempted to calculate rod lambda when not attached to"
@@ -123,6 +159,15 @@ bool Anchor::CalcRodLambda() {
   return true;
 }
 void Anchor::UpdatePosition() {
+  /* Anchors on a motor track are moved by the track sweep */
+  if (on_track_)
+    return;
+  DiffuseAndWalk();
+}
+
+void Anchor::UpdatePositionOnTrack() { DiffuseAndWalk(); }
+
+void Anchor::DiffuseAndWalk() {
   // Currently only bound anchors diffuse/walk (no explicit unbound anchors)
   bool diffuse = GetDiffusionConst() > 0 ? true : false;
   bool walker = abs(GetMaxVelocity()) > input_tol ? true : false;
@@ -233,6 +278,7 @@ void Anchor::Unbind() {
   bond_lambda_ = -1;
   mesh_lambda_ = -1;
   active_ = false;
+  on_track_ = false;
   ClearNeighbors();
   ZeroForce();
   SetCompID(-1);
@@ -248,26 +294,63 @@ double Anchor::CalcSingleBindRate() {
   else if (rod_) o = rod_;
   // Will sometimes be called w/ unbound anchor during initialization/clearing steps
   else return 0.0;
-  std::string name = o->GetName();
-  if (bind_param_map_->at(index_)[name].single_occupancy) {
-    double obj_amount = (bind_param_map_->at(index_)[name].dens_type == +density_type::linear) 
-                        ? o->GetLength() : o->GetArea();
-    // Sum both anchor rates because during binding and unbinding the bind rate will 
-    // increased for both floating anchors.
-    for (int i = 0; i < 2; i++) {
-      single_bind_rate += bind_param_map_->at(index_)[name].k_on_s 
-                          * bind_param_map_->at(index_)[name].bind_site_density * obj_amount;
+  // Sum both anchor rates because during binding and unbinding the bind rate will 
+  // increased for both floating anchors.
+  for (int i = 0; i < 2; i++) {
+    bind_params *bparams =
+        FindBindParams(bind_param_map_->at(i), bind_param_ids_->at(i), o);
+    if (bparams && bparams->single_occupancy) {
+      double obj_amount = (bparams->dens_type == +density_type::linear) 
+                          ? o->GetLength() : o->GetArea();
+      single_bind_rate += bparams->k_on_s * bparams->bind_site_density * obj_amount;
     }
   }
   return single_bind_rate;
 }
 
-// Increase the bind rate if an occupied object became unbound
+/* Increase the bind rate if an occupied object became unbound. Only spheres
+   track their occupancy, which matches how the crosslink manager tallies
+   binding totals, so the totals stay exact between full recounts. Anchors
+   unbind in parallel, so the change is applied later by FlushBindRate. */
 void Anchor::AddBackBindRate() {
+  if (!sphere_) return;
+  changed_spheres_.push_back(sphere_);
+  if (use_bind_file_ && bind_rate_) {
+    bind_rate_change_ += CalcSingleBindRate();
+  } else {
+    obj_size_change_ += sphere_->GetArea();
+  }
+}
+
+// Decrease the bind rate once the object bound by this anchor is occupied
+void Anchor::RemoveBindRate() {
+  if (!sphere_) return;
+  changed_spheres_.push_back(sphere_);
   if (use_bind_file_ && bind_rate_) {
-    *bind_rate_ += CalcSingleBindRate();
+    bind_rate_change_ -= CalcSingleBindRate();
   } else {
-    if (sphere_) *obj_size_ += sphere_->GetArea();
+    obj_size_change_ -= sphere_->GetArea();
+  }
+}
+
+/* Apply pending bind rate changes. Called serially in crosslink order so the
+   shared totals do not depend on the number of threads. */
+void Anchor::FlushBindRate() {
+  if (bind_rate_change_ != 0) {
+    *bind_rate_ += bind_rate_change_;
+    bind_rate_change_ = 0;
+  }
+  if (obj_size_change_ != 0) {
+    *obj_size_ += obj_size_change_;
+    obj_size_change_ = 0;
+  }
+  if (!changed_spheres_.empty()) {
+    if (occupancy_changes_) {
+      occupancy_changes_->insert(occupancy_changes_->end(),
+                                 changed_spheres_.begin(),
+                                 changed_spheres_.end());
+    }
+    changed_spheres_.clear();
   }
 }
 
@@ -355,7 +438,6 @@ void Anchor::AttachObjRandom(Object *o) {
         if (o->GetNAnchored() > 0) {
           Logger::Error("Xlink tried to bind to already occupied sphere!");
         }
-        *obj_size_ -= o->GetArea();
       }
       AttachObjCenter(o);
       break;
@@ -365,9 +447,8 @@ void Anchor::AttachObjRandom(Object *o) {
                     " Anchor::AttachObjRandom", o->GetType()._to_string());
     }
   }
-  if (use_bind_file_ && bind_rate_) {
-    *bind_rate_ -= CalcSingleBindRate();
-  }
+  RemoveBindRate();
+  FlushBindRate();
 }
     
 void Anchor::AttachObjLambda(Object *o, double lambda) {
@@ -542,7 +623,13 @@ int const Anchor::GetBoundOID() {
    ( e.g. rod_ -> null ) */
 void Anchor::SetBound() { bound_ = true; }
 
-void Anchor::AddNeighbor(Object *neighbor) { neighbors_.AddNeighbor(neighbor); }
+void Anchor::AddNeighbor(const Rod *neighbor) {
+  neighbors_.AddNeighbor(neighbor);
+}
+
+void Anchor::AddNeighbor(const Sphere *neighbor) {
+  neighbors_.AddNeighbor(neighbor);
+}
 
 void Anchor::ClearNeighbors() { neighbors_.Clear(); }
 
@@ -575,17 +662,20 @@ const int Anchor::GetNNeighborsSphere() const { return neighbors_.NNeighborsSphe
 
 
 
-void Anchor::WriteSpec(std::fstream &ospec) {
+void Anchor::WriteSpec(FrameBuffer &ospec) {
   ospec.write(reinterpret_cast<char *>(&bound_), sizeof(bool));
   ospec.write(reinterpret_cast<char *>(&active_), sizeof(bool));
   ospec.write(reinterpret_cast<char *>(&static_flag_), sizeof(bool));
   for (int i = 0; i < 3; ++i) {
-    ospec.write(reinterpret_cast<char *>(&position_[i]), sizeof(double));
+    ospec.write(reinterpret_cast<char *>(&position_[i]), sizeof(double),
+                field_length);
   }
   for (int i = 0; i < 3; ++i) {
-    ospec.write(reinterpret_cast<char *>(&orientation_[i]), sizeof(double));
+    ospec.write(reinterpret_cast<char *>(&orientation_[i]), sizeof(double),
+                field_unit);
   }
-  ospec.write(reinterpret_cast<char *>(&mesh_lambda_), sizeof(double));
+  ospec.write(reinterpret_cast<char *>(&mesh_lambda_), sizeof(double),
+              field_length);
   int attached_comp_id = comp_ != nullptr ? comp_->GetCompID() : -1;
   ospec.write(reinterpret_cast<char *>(&attached_comp_id), sizeof(int));
 }
@@ -596,7 +686,7 @@ void Anchor::WriteSpecTextHeader(std::fstream &otext) {
         << "comp_id" << std::endl;
 }
 
-void Anchor::ConvertSpec(std::fstream &ispec, std::fstream &otext) {
+void Anchor::ConvertSpec(FrameReader &ispec, std::fstream &otext) {
   bool bound, active, static_flag;
   double position[3], orientation[3];
   double mesh_lambda;
@@ -619,7 +709,30 @@ void Anchor::ConvertSpec(std::fstream &ispec, std::fstream &otext) {
         << " " << orientation[2] << " " << mesh_lambda << " " << comp_id << std::endl;
 }
 
-void Anchor::ReadSpec(std::fstream &ispec) {
+void Anchor::ExportSpec(FrameReader &ispec, ColumnFrame &columns) {
+  bool bound, active, static_flag;
+  double position[3], orientation[3];
+  double mesh_lambda;
+  int comp_id;
+  if (ispec.eof())
+    return;
+  ispec.read(reinterpret_cast<char *>(&bound), sizeof(bool));
+  ispec.read(reinterpret_cast<char *>(&active), sizeof(bool));
+  ispec.read(reinterpret_cast<char *>(&static_flag), sizeof(bool));
+  ispec.read(reinterpret_cast<char *>(position), sizeof(position));
+  ispec.read(reinterpret_cast<char *>(orientation), sizeof(orientation));
+  ispec.read(reinterpret_cast<char *>(&mesh_lambda), sizeof(double));
+  ispec.read(reinterpret_cast<char *>(&comp_id), sizeof(int));
+  columns.Add("bound", &bound);
+  columns.Add("active", &active);
+  columns.Add("static_flag", &static_flag);
+  columns.Add("position", position, 3);
+  columns.Add("orientation", orientation, 3);
+  columns.Add("mesh_lambda", &mesh_lambda);
+  columns.Add("comp_id", &comp_id);
+}
+
+void Anchor::ReadSpec(FrameReader &ispec) {
   ispec.read(reinterpret_cast<char *>(&bound_), sizeof(bool));
   ispec.read(reinterpret_cast<char *>(&active_), sizeof(bool));
   ispec.read(reinterpret_cast<char *>(&static_flag_), sizeof(bool));
@@ -758,6 +871,10 @@ void Anchor::SetBindRate(double* bind_rate) {
   bind_rate_ = bind_rate;
 }
 
+void Anchor::SetOccupancyChanges(std::vector<Object *> *occupancy_changes) {
+  occupancy_changes_ = occupancy_changes;
+}
+
 const double Anchor::GetKonS() const {
   return k_on_s_;
 }
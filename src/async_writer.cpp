@@ -0,0 +1,106 @@
+#include "cglass/async_writer.hpp"
+
+void AsyncWriter::Start(int max_pending) {
+  if (running_) {
+    return;
+  }
+  max_pending_ = (max_pending < 1 ? 1 : max_pending);
+  running_ = true;
+  thread_ = std::thread(&AsyncWriter::Run, this);
+}
+
+void AsyncWriter::Enqueue(FrameBuffer &frame, std::fstream *out,
+                          std::string const &file_name) {
+  std::unique_lock<std::mutex> lk(mtx_);
+  /* Back-pressure: hold the simulation until the queue has room */
+  space_cv_.wait(lk, [this] { return (int)queue_.size() < max_pending_; });
+  RaiseError(lk);
+  queue_.emplace_back();
+  frame_job &job = queue_.back();
+  job.out = out;
+  job.file_name = file_name;
+  if (!pool_.empty()) {
+    job.frame.Swap(pool_.back());
+    pool_.pop_back();
+  }
+  /* The caller keeps the pooled (empty) buffer and its capacity */
+  job.frame.Swap(frame);
+  lk.unlock();
+  queue_cv_.notify_one();
+}
+
+void AsyncWriter::Submit(FrameBuffer &frame, std::fstream &out) {
+  Enqueue(frame, &out, std::string());
+}
+
+void AsyncWriter::Submit(FrameBuffer &frame, std::string const &file_name) {
+  Enqueue(frame, nullptr, file_name);
+}
+
+void AsyncWriter::Run() {
+  std::unique_lock<std::mutex> lk(mtx_);
+  while (true) {
+    queue_cv_.wait(lk, [this] { return !queue_.empty() || !running_; });
+    if (queue_.empty()) {
+      break;
+    }
+    frame_job job(std::move(queue_.front()));
+    queue_.pop_front();
+    busy_ = true;
+    lk.unlock();
+    space_cv_.notify_all();
+    std::string error;
+    if (job.out) {
+      job.frame.Flush(*job.out);
+      if (job.out->fail()) {
+        error = "Output frame could not be written";
+      }
+    } else if (!job.frame.Replace(job.file_name)) {
+      error = "Output " + job.file_name + " file could not be written";
+    }
+    lk.lock();
+    if (error_.empty()) {
+      error_ = error;
+    }
+    busy_ = false;
+    pool_.push_back(std::move(job.frame));
+    space_cv_.notify_all();
+  }
+}
+
+void AsyncWriter::Drain() {
+  if (!running_) {
+    return;
+  }
+  std::unique_lock<std::mutex> lk(mtx_);
+  space_cv_.wait(lk, [this] { return queue_.empty() && !busy_; });
+  RaiseError(lk);
+}
+
+/* Logger::Error exits, which must not happen on the writer thread while the
+   simulation thread is still using the queue, so failures are reported from
+   here instead */
+void AsyncWriter::RaiseError(std::unique_lock<std::mutex> &lk) {
+  if (error_.empty()) {
+    return;
+  }
+  std::string error(error_);
+  lk.unlock();
+  Logger::Error("%s", error.c_str());
+}
+
+void AsyncWriter::Stop() {
+  if (!running_) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lk(mtx_);
+    running_ = false;
+  }
+  queue_cv_.notify_one();
+  /* The writer empties the queue before it exits */
+  thread_.join();
+  pool_.clear();
+  std::unique_lock<std::mutex> lk(mtx_);
+  RaiseError(lk);
+}
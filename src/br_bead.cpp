@@ -6,7 +6,7 @@ BrBead::BrBead(unsigned long seed) : Object(seed) {
 
 void BrBead::Init(br_bead_parameters *sparams) {
   sparams_ = sparams;
-  name_ = sparams_->name;
+  SetName(sparams_->name);
   color_ = sparams_->color;
   draw_ = draw_type::_from_string(sparams_->draw_type.c_str());
   diameter_ = sparams_->diameter;
@@ -204,7 +204,7 @@ void BrBead::Draw(std::vector<graph_struct *> &graph_array) {
     Object::Draw(graph_array);
   }
 }
-void BrBead::WriteSpec(std::fstream &ospec) {
+void BrBead::WriteSpec(FrameBuffer &ospec) {
   Logger::Trace("Writing br_bead specs, object id: %d", GetOID());
   Object::WriteSpec(ospec);
   ospec.write(reinterpret_cast<char *>(&chiral_handedness_), sizeof(int));
@@ -217,7 +217,7 @@ void BrBead::WriteSpecTextHeader(std::fstream &otext) {
         << "chiral_handedness" << std::endl;
 }
 
-void BrBead::ConvertSpec(std::fstream &ispec, std::fstream &otext) {
+void BrBead::ConvertSpec(FrameReader &ispec, std::fstream &otext) {
   double position[3], scaled_position[3], orientation[3];
   double diameter, length;
   int chiral_handedness;
@@ -239,7 +239,16 @@ void BrBead::ConvertSpec(std::fstream &ispec, std::fstream &otext) {
         << chiral_handedness << std::endl;
 }
 
-void BrBead::ReadSpec(std::fstream &ispec) {
+void BrBead::ExportSpec(FrameReader &ispec, ColumnFrame &columns) {
+  int chiral_handedness;
+  if (ispec.eof())
+    return;
+  Object::ExportSpec(ispec, columns);
+  ispec.read(reinterpret_cast<char *>(&chiral_handedness), sizeof(int));
+  columns.Add("chiral_handedness", &chiral_handedness);
+}
+
+void BrBead::ReadSpec(FrameReader &ispec) {
   Object::ReadSpec(ispec);
   ispec.read(reinterpret_cast<char *>(&chiral_handedness_), sizeof(int));
   if (sparams_->highlight_handedness) {
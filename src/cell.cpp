@@ -9,6 +9,26 @@ void Cell::AddObj(Object &obj) {
 
 void Cell::PopBack() { cell_objs_.pop_back(); }
 
+/* Remove objects by pointer only, since they may have been destroyed */
+void Cell::RemoveObjs(std::vector<Object *> const &objs) {
+  cell_objs_.erase(std::remove_if(cell_objs_.begin(), cell_objs_.end(),
+                                  [&objs](Object *obj) {
+                                    return std::find(objs.begin(), objs.end(),
+                                                     obj) != objs.end();
+                                  }),
+                   cell_objs_.end());
+}
+
+/* Like PairSingleObject, but only keeps pairs of interacting species */
+void Cell::PairNewObject(Object &obj,
+                         std::vector<Interaction> &pair_list) const {
+  for (size_t i = 0; i < cell_objs_.size(); ++i) {
+    if (IsInteractingPair(obj.GetSID(), cell_objs_[i]->GetSID())) {
+      pair_list.push_back(Interaction(&obj, cell_objs_[i]));
+    }
+  }
+}
+
 const int Cell::NObjs() const { return cell_objs_.size(); }
 
 void Cell::MakePairs(std::vector<Interaction> &pair_list) const {
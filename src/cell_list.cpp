@@ -264,6 +264,61 @@ void CellList::AssignCellNeighbors(bool redundancy) {
   }
 }
 
+/* Pair a new object with all objects in its cell and adjacent cells, then
+   add it to its cell. Does not rely on redundant cell neighbors, so it can be
+   used to insert objects into the cell list used for pair interactions
+   without rebuilding it. */
+void CellList::AddObject(Object &obj, std::vector<Interaction> &pair_list) {
+  int x, y, z;
+  std::tie(x, y, z) = FindCellCoords(obj);
+  std::vector<Cell *> cells;
+  int dz = (_n_dim_ == 3 ? 1 : 0);
+  for (int zp = z - dz; zp <= z + dz; ++zp) {
+    int nz = zp;
+    if ((nz < 0 || nz == _n_cells_1d_) && _n_periodic_ >= 3) {
+      nz = (nz < 0 ? _n_cells_1d_ - 1 : 0);
+    } else if (nz < 0 || nz == _n_cells_1d_) {
+      continue;
+    }
+    for (int yp = y - 1; yp <= y + 1; ++yp) {
+      int ny = yp;
+      if ((ny < 0 || ny == _n_cells_1d_) && _n_periodic_ >= 2) {
+        ny = (ny < 0 ? _n_cells_1d_ - 1 : 0);
+      } else if (ny < 0 || ny == _n_cells_1d_) {
+        continue;
+      }
+      for (int xp = x - 1; xp <= x + 1; ++xp) {
+        int nx = xp;
+        if ((nx < 0 || nx == _n_cells_1d_) && _n_periodic_ >= 1) {
+          nx = (nx < 0 ? _n_cells_1d_ - 1 : 0);
+        } else if (nx < 0 || nx == _n_cells_1d_) {
+          continue;
+        }
+        /* Periodic images may wrap onto the same cell for small cell lists */
+        Cell *c = &cell_[nx][ny][nz];
+        if (std::find(cells.begin(), cells.end(), c) == cells.end()) {
+          cells.push_back(c);
+        }
+      }
+    }
+  }
+  for (auto cell = cells.begin(); cell != cells.end(); ++cell) {
+    (*cell)->PairNewObject(obj, pair_list);
+  }
+  cell_[x][y][z].AddObj(obj);
+}
+
+void CellList::RemoveObjects(std::vector<Object *> const &objs) {
+  int third_dim = (_n_dim_ == 3 ? _n_cells_1d_ : 1);
+  for (int i = 0; i < _n_cells_1d_; ++i) {
+    for (int j = 0; j < _n_cells_1d_; ++j) {
+      for (int k = 0; k < third_dim; ++k) {
+        cell_[i][j][k].RemoveObjs(objs);
+      }
+    }
+  }
+}
+
 /* Relies on redundant cell list neighbor pairs to identify all potential
    interactions with this object */
 void CellList::PairSingleObject(Object &obj,
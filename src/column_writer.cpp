@@ -0,0 +1,222 @@
+#include "cglass/column_writer.hpp"
+#include <cerrno>
+#include <sstream>
+#include <sys/stat.h>
+
+/* Size of the .npy header, large enough for any final shape. npy requires the
+   header to be a multiple of 64 bytes. */
+static const int npy_header_size = 128;
+
+static bool ColumnNameMatches(std::string const &column_name,
+                              std::string const &prefix,
+                              std::string const &name) {
+  return column_name.size() == prefix.size() + name.size() &&
+         column_name.compare(0, prefix.size(), prefix) == 0 &&
+         column_name.compare(prefix.size(), name.size(), name) == 0;
+}
+
+ColumnFrame::column &ColumnFrame::Get(std::string const &name,
+                                      const char *descr, int width,
+                                      bool offsets) {
+  size_t i = next_;
+  if (i >= columns_.size() || !ColumnNameMatches(columns_[i].name, prefix_,
+                                                   name)) {
+    for (i = 0; i < columns_.size(); ++i) {
+      if (ColumnNameMatches(columns_[i].name, prefix_, name)) {
+        break;
+      }
+    }
+    if (i == columns_.size()) {
+      column col;
+      col.name = prefix_ + name;
+      col.descr = descr;
+      col.width = width;
+      col.offsets = offsets;
+      col.rows = 0;
+      columns_.push_back(col);
+    }
+  }
+  column &col = columns_[i];
+  if (col.width != width || col.descr.compare(descr) != 0) {
+    Logger::Error("Column %s changed its type or width", col.name.c_str());
+  }
+  next_ = i + 1;
+  return col;
+}
+
+void ColumnFrame::Append(std::string const &name, const char *descr,
+                         const void *values, size_t size, int width,
+                         bool offsets) {
+  column &col = Get(name, descr, width, offsets);
+  const char *data = reinterpret_cast<const char *>(values);
+  col.data.insert(col.data.end(), data, data + size);
+  col.rows++;
+}
+
+void ColumnFrame::Add(std::string const &name, const double *values,
+                      int width) {
+  Append(name, "<f8", values, width * sizeof(double), width, false);
+}
+
+void ColumnFrame::Add(std::string const &name, const int *values, int width) {
+  Append(name, "<i4", values, width * sizeof(int), width, false);
+}
+
+void ColumnFrame::Add(std::string const &name, const bool *values, int width) {
+  Append(name, "|b1", values, width * sizeof(bool), width, false);
+}
+
+void ColumnFrame::Add(std::string const &name, const unsigned char *values,
+                      int width) {
+  Append(name, "|u1", values, width * sizeof(unsigned char), width, false);
+}
+
+void ColumnFrame::AddCount(std::string const &group, int count) {
+  int64_t n = count;
+  Append(group + "_offsets", "<i8", &n, sizeof(int64_t), 1, true);
+}
+
+void ColumnFrame::BeginGroup(std::string const &group) {
+  prefix_sizes_.push_back(prefix_.size());
+  prefix_ += group + "_";
+}
+
+void ColumnFrame::EndGroup() {
+  if (prefix_sizes_.empty()) {
+    return;
+  }
+  prefix_.resize(prefix_sizes_.back());
+  prefix_sizes_.pop_back();
+}
+
+void ColumnFrame::Clear() {
+  for (auto it = columns_.begin(); it != columns_.end(); ++it) {
+    it->data.clear();
+    it->rows = 0;
+  }
+  prefix_.clear();
+  prefix_sizes_.clear();
+  next_ = 0;
+}
+
+bool ColumnWriter::Open(std::string const &dir) {
+  Close();
+  if (mkdir(dir.c_str(), 0755) != 0 && errno != EEXIST) {
+    return false;
+  }
+  struct stat st;
+  if (stat(dir.c_str(), &st) != 0 || !S_ISDIR(st.st_mode)) {
+    return false;
+  }
+  dir_ = dir;
+  return true;
+}
+
+ColumnWriter::column_file *ColumnWriter::GetFile(std::string const &name,
+                                                 std::string const &descr,
+                                                 int width, bool offsets) {
+  auto it = files_.find(name);
+  if (it != files_.end()) {
+    column_file *col = it->second.get();
+    if (col->width != width || col->descr != descr) {
+      Logger::Error("Column %s changed its type or width", name.c_str());
+    }
+    return col;
+  }
+  std::unique_ptr<column_file> col(new column_file);
+  col->descr = descr;
+  col->width = width;
+  col->offsets = offsets;
+  std::string file_name = dir_ + "/" + name + ".npy";
+  col->file.open(file_name, std::ios::out | std::ios::binary);
+  if (!col->file.is_open()) {
+    Logger::Error("Output file %s did not open", file_name.c_str());
+  }
+  WriteHeader(*col);
+  if (offsets) {
+    /* Offsets start at zero */
+    Write(*col, reinterpret_cast<const char *>(&col->total), sizeof(int64_t),
+          1);
+  }
+  return (files_[name] = std::move(col)).get();
+}
+
+/* npy format 1.0: magic, version, header length, then a dict literal padded
+   with spaces and terminated by a newline */
+void ColumnWriter::WriteHeader(column_file &col) {
+  std::ostringstream dict;
+  dict << "{'descr': '" << col.descr
+       << "', 'fortran_order': False, 'shape': (" << col.rows;
+  if (col.width > 1) {
+    dict << ", " << col.width;
+  } else {
+    dict << ",";
+  }
+  dict << "), }";
+  std::string header = dict.str();
+  header.resize(npy_header_size - 11, ' ');
+  header += '\n';
+  uint16_t header_len = header.size();
+  unsigned char header_len_le[2] = {
+      static_cast<unsigned char>(header_len & 0xff),
+      static_cast<unsigned char>(header_len >> 8)};
+  col.file.seekp(0);
+  col.file.write("\x93NUMPY\x01\x00", 8);
+  col.file.write(reinterpret_cast<char *>(header_len_le), 2);
+  col.file.write(header.data(), header.size());
+}
+
+void ColumnWriter::Write(column_file &col, const char *data, size_t size,
+                         int64_t rows) {
+  col.file.write(data, size);
+  col.rows += rows;
+}
+
+/* Counts are written as the running offset following each row */
+void ColumnWriter::WriteOffsets(column_file &col, const int64_t *counts,
+                                int64_t rows) {
+  std::vector<int64_t> offsets(rows);
+  for (int64_t i = 0; i < rows; ++i) {
+    col.total += counts[i];
+    offsets[i] = col.total;
+  }
+  Write(col, reinterpret_cast<const char *>(offsets.data()),
+        rows * sizeof(int64_t), rows);
+}
+
+void ColumnWriter::Append(ColumnFrame const &frame, int step, double time,
+                          int n_members) {
+  std::vector<ColumnFrame::column> const &columns = frame.Columns();
+  for (auto it = columns.begin(); it != columns.end(); ++it) {
+    if (it->rows == 0) {
+      continue;
+    }
+    column_file *col = GetFile(it->name, it->descr, it->width, it->offsets);
+    if (it->offsets) {
+      WriteOffsets(*col, reinterpret_cast<const int64_t *>(it->data.data()),
+                   it->rows);
+    } else {
+      Write(*col, it->data.data(), it->data.size(), it->rows);
+    }
+  }
+  column_file *col = GetFile("step", "<i4", 1, false);
+  Write(*col, reinterpret_cast<const char *>(&step), sizeof(int), 1);
+  col = GetFile("time", "<f8", 1, false);
+  Write(*col, reinterpret_cast<const char *>(&time), sizeof(double), 1);
+  int64_t count = n_members;
+  WriteOffsets(*GetFile("frame_offsets", "<i8", 1, true), &count, 1);
+}
+
+/* Fill in the final shapes */
+void ColumnWriter::Close() {
+  for (auto it = files_.begin(); it != files_.end(); ++it) {
+    column_file &col = *it->second;
+    WriteHeader(col);
+    col.file.close();
+    if (col.file.fail()) {
+      Logger::Warning("Column file %s/%s.npy was not completely written",
+                      dir_.c_str(), it->first.c_str());
+    }
+  }
+  files_.clear();
+}
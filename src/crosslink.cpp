@@ -7,7 +7,7 @@ Crosslink::Crosslink(unsigned long seed) : Object(seed) {
 
 void Crosslink::Init(crosslink_parameters *sparams) {
   sparams_ = sparams;
-  name_ = sparams_->name;
+  SetName(sparams_->name);
   length_ = -1;
   diameter_ = sparams_->tether_diameter;
   color_ = sparams_->tether_color;
@@ -27,11 +27,11 @@ void Crosslink::Init(crosslink_parameters *sparams) {
   fdep_length_ = sparams_->force_dep_length;
   polar_affinity_ = sparams_->polar_affinity;
   use_bind_file_ = sparams_->anchors[0].bind_file.compare("none");
+  event_driven_ = sparams_->event_driven_kinetics;
   
-  Anchor anchor1(rng_.GetSeed());
-  Anchor anchor2(rng_.GetSeed());
-  anchors_.push_back(anchor1);
-  anchors_.push_back(anchor2);
+  anchors_.reserve(2);
+  anchors_.emplace_back(rng_.GetSeed());
+  anchors_.emplace_back(rng_.GetSeed());
   anchors_[0].Init(sparams_, 0);
   anchors_[1].Init(sparams_, 1);
   SetSingly(bound_anchor_);
@@ -39,12 +39,9 @@ void Crosslink::Init(crosslink_parameters *sparams) {
                 anchors_[0].GetOID(), anchors_[1].GetOID());
 }
 
-void Crosslink::InitInteractionEnvironment(LookupTable *lut, Tracker *tracker, 
-                                           std::map<Sphere *, std::pair<std::vector<double>, 
-                                           std::vector<Anchor*> > > *bound_curr) { 
+void Crosslink::InitInteractionEnvironment(LookupTable *lut, Tracker *tracker) { 
   lut_ = lut;
   tracker_ = tracker;
-  bound_curr_ = bound_curr;
 }
 
 /* Function used to set anchor[0] position etc to xlink position etc */
@@ -64,7 +61,8 @@ void Crosslink::GetAnchors(std::vector<Object *> &ixors) {
 /* Perform kinetic monte carlo step of protein with 1 head attached. */
 void Crosslink::SinglyKMC() {
 
-  double roll = rng_.RandomUniform();
+  /* Event-driven kinetics only draws a roll once a binding event fires */
+  double roll = (event_driven_ ? 0 : rng_.RandomUniform());
   int head_bound = 0;
   // Set up KMC objects and calculate probabilities
   double unbind_prob = anchors_[bound_anchor_].GetOffRate() * delta_;
@@ -75,12 +73,6 @@ void Crosslink::SinglyKMC() {
   int n_neighbors_rod = anchors_[bound_anchor_].GetNNeighborsRod();
   int n_neighbors_sphere = anchors_[bound_anchor_].GetNNeighborsSphere();
   int n_neighbors = n_neighbors_rod + n_neighbors_sphere;
- 
-  /* Initialize KMC calculation */
-  KMC<Rod, Sphere> kmc_bind(anchors_[bound_anchor_].pos, n_neighbors_rod, n_neighbors_sphere, delta_, lut_);
-
-  /* Initialize periodic boundary conditions */
-  kmc_bind.SetPBCs(n_dim_, space_->n_periodic, space_->unit_cell);
 
   /* Calculate probability to bind */
   double kmc_bind_prob = 0;
@@ -88,16 +80,18 @@ void Crosslink::SinglyKMC() {
   const std::vector<const Rod*>& rod_nbr_list = anchors_[bound_anchor_].GetNeighborListMemRods();
   const std::vector<const Sphere*>& sphere_nbr_list = anchors_[bound_anchor_].GetNeighborListMemSpheres();
   if (use_bind_file_) {
-    for (int i = 0; i < rod_nbr_list.size(); ++i) {
-      std::string name = rod_nbr_list[i]->GetName();
-      bind_factors[i] = bind_param_map_->at((int)!bound_anchor_)[name].k_on_d
-                        * bind_param_map_->at((int)!bound_anchor_)[name].bind_site_density;
+    int free_anchor = (int)!bound_anchor_;
+    auto &by_name = bind_param_map_->at(free_anchor);
+    auto &by_id = bind_param_ids_->at(free_anchor);
+    for (size_t i = 0; i < rod_nbr_list.size(); ++i) {
+      bind_params *bparams = FindBindParams(by_name, by_id, rod_nbr_list[i]);
+      bind_factors[i] =
+          (bparams ? bparams->k_on_d * bparams->bind_site_density : 0);
     }
-    for (int i = 0; i < sphere_nbr_list.size(); ++i) {
-      std::string name = sphere_nbr_list[i]->GetName();
+    for (size_t i = 0; i < sphere_nbr_list.size(); ++i) {
+      bind_params *bparams = FindBindParams(by_name, by_id, sphere_nbr_list[i]);
       bind_factors[rod_nbr_list.size() + i] =
-               bind_param_map_->at((int)!bound_anchor_)[name].k_on_d
-               * bind_param_map_->at((int)!bound_anchor_)[name].bind_site_density;
+          (bparams ? bparams->k_on_d * bparams->bind_site_density : 0);
     }
   } else {
   double bind_factor_rod = anchors_[(int)!bound_anchor_].GetOnRate() * bind_site_density_;
@@ -107,11 +101,32 @@ void Crosslink::SinglyKMC() {
     std::fill(bind_factors.begin(), bind_factors.begin() + n_neighbors_rod, bind_factor_rod);
     std::fill(bind_factors.begin() + n_neighbors_rod, bind_factors.end(), bind_factor_sphere);
   }
+  if (n_neighbors > 0 && !static_flag_ && polar_affinity_ != 1.0) {
+    anchors_[bound_anchor_].CalculatePolarAffinity(bind_factors);
+  }
+
+  int head_activate = -1;
+  /* Event-driven kinetics schedules candidate binding events against an upper
+     bound on the binding probability, and only sets up the KMC calculation on
+     steps where a candidate fires. */
+  double bind_bound = (event_driven_ ? BindProbBound(bind_factors, n_neighbors_sphere) : -1);
+  if (bind_bound >= 0) {
+    head_activate = ChooseEvent(unbind_prob, bind_bound);
+    if (head_activate != 1) {
+      if (head_activate == 0) {
+        UnbindSingly();
+      }
+      return;
+    }
+  }
  
+  /* Initialize KMC calculation */
+  KMC<Rod, Sphere> kmc_bind(anchors_[bound_anchor_].pos, n_neighbors_rod, n_neighbors_sphere, delta_, lut_);
+
+  /* Initialize periodic boundary conditions */
+  kmc_bind.SetPBCs(n_dim_, space_->n_periodic, space_->unit_cell);
+
   if (n_neighbors > 0) {
-    if (!static_flag_ && polar_affinity_ != 1.0) {
-      anchors_[bound_anchor_].CalculatePolarAffinity(bind_factors);
-    }
     /* Use auto-filter populated with 1's for every neighbor.
     We already guarantee uniqueness, so we won't overcount. */
     kmc_bind.LUCalcTotProbsSD(anchors_[bound_anchor_].GetNeighborListMemRods(), 
@@ -120,15 +135,29 @@ void Crosslink::SinglyKMC() {
     kmc_bind_prob = kmc_bind.getTotProb();
     tracker_->TrackSD(kmc_bind_prob);
   } // Find out whether we bind, unbind, or neither.
-  int head_activate = choose_kmc_double(unbind_prob, kmc_bind_prob, roll);
+  if (bind_bound >= 0) {
+    /* Accept the candidate with probability kmc_bind_prob / bind_bound. An
+       accepted roll is uniform within the binding probability, as
+       choose_kmc_double would leave it. */
+    if (kmc_bind_prob > bind_bound) {
+      Logger::Warning("Crosslink %d binding probability %2.2e exceeds its "
+                      "bound %2.2e, evaluating it every step", GetOID(),
+                      kmc_bind_prob, bind_bound);
+      bind_bound_exceeded_ = true;
+    }
+    roll = bind_bound * rng_.RandomUniform();
+    head_activate = (roll < kmc_bind_prob ? 1 : -1);
+  } else if (event_driven_) {
+    head_activate = ChooseEvent(unbind_prob, kmc_bind_prob);
+    if (head_activate == 1) {
+      roll = kmc_bind_prob * rng_.RandomUniform();
+    }
+  } else {
+    head_activate = choose_kmc_double(unbind_prob, kmc_bind_prob, roll);
+  }
   // Change status of activated head
   if (head_activate == 0) {
-    // Unbind bound head
-    // Track unbinding
-    tracker_->UnbindSU();
-    anchors_[bound_anchor_].Unbind();
-    SetUnbound();
-    Logger::Trace("Crosslink %d came unbound", GetOID());
+    UnbindSingly();
   } else if (head_activate == 1) {
     // Bind unbound head
     // Track binding
@@ -161,18 +190,46 @@ void Crosslink::SinglyKMC() {
       Logger::Trace("Crosslink %d became doubly bound to obj %d", GetOID(),
                   bind_obj->GetOID());
     } else {
-      Sphere *bind_obj = anchors_[bound_anchor_].GetSphereNeighbor(i_bind - n_neighbors_rod);
-      (*bound_curr_)[bind_obj].first.push_back(kmc_bind.getProb(i_bind));
-      (*bound_curr_)[bind_obj].second.push_back(&anchors_[(int)!bound_anchor_]);
-      anchors_[(int)!bound_anchor_].AttachObjCenter(bind_obj);
-      bind_obj->DecrementNAnchored(); // For knockout loop- allow collisions
-      SetDoubly();
-      Logger::Trace("Crosslink %d became doubly bound to obj %d", GetOID(),
-                  bind_obj->GetOID());
+      /* Spheres can only hold one anchor, so other crosslinks may compete
+         for the same sphere. Binding is committed after all crosslinks have
+         chosen their targets. */
+      sphere_proposal_ =
+          anchors_[bound_anchor_].GetSphereNeighbor(i_bind - n_neighbors_rod);
+      sphere_proposal_prob_ = kmc_bind.getProb(i_bind);
     }
   }
 }
 
+/* Unbind the bound head of a singly bound crosslink */
+void Crosslink::UnbindSingly() {
+  // Track unbinding
+  tracker_->UnbindSU();
+  anchors_[bound_anchor_].Unbind();
+  SetUnbound();
+  Logger::Trace("Crosslink %d came unbound", GetOID());
+}
+
+/* Upper bound on the probability of binding the free head this step, or -1 if
+   there is none and the KMC sum has to be evaluated every step. The Boltzmann
+   factor integrated by the lookup table is at most one, and a rod crosses at
+   most 2 rcutoff of the binding range, so each rod neighbor contributes at
+   most its bind factor times 2 rcutoff delta. Spheres have no such bound. */
+double Crosslink::BindProbBound(std::vector<double> const &bind_factors,
+                                int n_neighbors_sphere) {
+  if (n_neighbors_sphere > 0 || bind_bound_exceeded_) {
+    return -1;
+  }
+  double bound = 0;
+  for (auto factor : bind_factors) {
+    bound += factor;
+  }
+  double bind_range = 2 * lut_->getLUCutoff();
+  if (sparams_->use_binding_volume) {
+    bind_range /= lut_->getBindVolume();
+  }
+  return bound * bind_range * delta_;
+}
+
 /* Perform kinetic monte carlo step of protein with 2 heads of protein
  * object attached. */
 void Crosslink::DoublyKMC() {
@@ -188,18 +245,22 @@ void Crosslink::DoublyKMC() {
     e_dep *= 0.5 * k_spring_ * SQR(tether_stretch);
     f_dep *= k_spring_ * tether_stretch;
   }
-  std::vector<double> unbind_prob;
+  double unbind_prob[2];
   for (int i = 0; i < 2; i++) {
-    unbind_prob.push_back(anchors_[i].GetOffRate() * delta_ * exp(e_dep + f_dep));
+    unbind_prob[i] = anchors_[i].GetOffRate() * delta_ * exp(e_dep + f_dep);
   }
   tracker_->TrackDS(unbind_prob[0]); // Richelle modify to track full prob
-  double roll = rng_.RandomUniform();
   int head_activate = -1;
-  if (static_flag_) {
+  if (event_driven_) {
+    head_activate =
+        ChooseEvent((static_flag_ ? 0 : unbind_prob[0]), unbind_prob[1]);
+  } else if (static_flag_) {
+    double roll = rng_.RandomUniform();
     head_activate = choose_kmc_double(0, unbind_prob[1], roll);
   } else {
     // Probability of unbinding follows a poisson process but assume that only
     // one head can unbind during a time step.
+    double roll = rng_.RandomUniform();
     head_activate = choose_kmc_double(unbind_prob[0], unbind_prob[1], roll);
   }
   if (head_activate > -1) {
@@ -211,6 +272,41 @@ void Crosslink::DoublyKMC() {
   }
 }
 
+/* Event-driven counterpart of choose_kmc_double. Each channel fires once the
+   probability it integrates over steps passes an exponential threshold, which
+   keeps Poisson statistics for slowly varying rates while drawing no random
+   numbers on steps where nothing happens. Returns the channel whose threshold
+   was crossed first within the step, or -1 if neither fired. */
+int Crosslink::ChooseEvent(double prob0, double prob1) {
+  double probs[2] = {prob0, prob1};
+  int fired = -1;
+  double first = 0;
+  for (int i = 0; i < 2; ++i) {
+    if (event_clock_[i] < 0) {
+      event_clock_[i] = rng_.RandomExponential(1);
+    }
+    if (probs[i] > 0 && probs[i] >= event_clock_[i]) {
+      double frac = event_clock_[i] / probs[i];
+      if (fired < 0 || frac < first) {
+        fired = i;
+        first = frac;
+      }
+    }
+  }
+  if (fired < 0) {
+    event_clock_[0] -= prob0;
+    event_clock_[1] -= prob1;
+  } else {
+    ResetEventClocks();
+  }
+  return fired;
+}
+
+/* Thresholds are redrawn whenever the set of reaction channels changes */
+void Crosslink::ResetEventClocks() {
+  event_clock_[0] = event_clock_[1] = -1;
+}
+
 void Crosslink::CalculateBinding() {
   if (IsSingly()) {
     SinglyKMC();
@@ -327,6 +423,22 @@ void Crosslink::CalculateTetherForces() {
   UpdatePeriodic();
 }
 
+/* Bind the unbound head to the sphere it chose in SinglyKMC */
+void Crosslink::CommitSphereProposal() {
+  if (!sphere_proposal_) return;
+  anchors_[(int)!bound_anchor_].AttachObjCenter(sphere_proposal_);
+  anchors_[(int)!bound_anchor_].RemoveBindRate();
+  SetDoubly();
+  Logger::Trace("Crosslink %d became doubly bound to obj %d", GetOID(),
+                sphere_proposal_->GetOID());
+  sphere_proposal_ = nullptr;
+}
+
+void Crosslink::FlushBindRates() {
+  anchors_[0].FlushBindRate();
+  anchors_[1].FlushBindRate();
+}
+
 /* Attach a crosslink anchor to object in a random fashion */
 void Crosslink::AttachObjRandom(std::pair<Object*, int> obj_index) {
   /* Attaching to random obj implies first anchor binding from solution, so
@@ -367,17 +479,20 @@ void Crosslink::Draw(std::vector<graph_struct *> &graph_array) {
 
 void Crosslink::SetDoubly() {
   state_ = bind_state::doubly;
+  ResetEventClocks();
   SetAnchorStates();
 }
 
 void Crosslink::SetSingly(int bound_anchor) {
   state_ = bind_state::singly;
   bound_anchor_ = bound_anchor;
+  ResetEventClocks();
   SetAnchorStates();
 }
 
 void Crosslink::SetUnbound() {
   state_ = bind_state::unbound;
+  ResetEventClocks();
   SetAnchorStates();
 }
 
@@ -392,19 +507,23 @@ const bool Crosslink::IsUnbound() const {
   return state_ == +bind_state::unbound;
 }
 
-void Crosslink::WriteSpec(std::fstream &ospec) {
+void Crosslink::WriteSpec(FrameBuffer &ospec) {
   if (IsUnbound()) {
     Logger::Error("Unbound crosslink tried to WriteSpec!");
   }
   bool is_doubly = IsDoubly();
   ospec.write(reinterpret_cast<char *>(&is_doubly), sizeof(bool));
-  ospec.write(reinterpret_cast<char *>(&diameter_), sizeof(double));
-  ospec.write(reinterpret_cast<char *>(&length_), sizeof(double));
+  ospec.write(reinterpret_cast<char *>(&diameter_), sizeof(double),
+              field_length);
+  ospec.write(reinterpret_cast<char *>(&length_), sizeof(double),
+              field_length);
   for (int i = 0; i < 3; ++i) {
-    ospec.write(reinterpret_cast<char *>(&position_[i]), sizeof(double));
+    ospec.write(reinterpret_cast<char *>(&position_[i]), sizeof(double),
+                field_length);
   }
   for (int i = 0; i < 3; ++i) {
-    ospec.write(reinterpret_cast<char *>(&orientation_[i]), sizeof(double));
+    ospec.write(reinterpret_cast<char *>(&orientation_[i]), sizeof(double),
+                field_unit);
   }
   ospec.write(reinterpret_cast<char *>(&oid_), sizeof(int));
   anchors_[0].WriteSpec(ospec);
@@ -416,7 +535,7 @@ void Crosslink::WriteSpecTextHeader(std::fstream &otext) {
         << "orientation[0] orientation[1] orientation[2] oid_" << std::endl;
 }
 
-void Crosslink::ConvertSpec(std::fstream &ispec, std::fstream &otext) {
+void Crosslink::ConvertSpec(FrameReader &ispec, std::fstream &otext) {
   if (ispec.eof())
     return;
   bool is_doubly;
@@ -445,7 +564,35 @@ void Crosslink::ConvertSpec(std::fstream &ispec, std::fstream &otext) {
   }
 }
 
-void Crosslink::ReadSpec(std::fstream &ispec) {
+/* Every crosslink has two anchors, so anchors 2i and 2i + 1 of the anchor
+   group belong to crosslink i */
+void Crosslink::ExportSpec(FrameReader &ispec, ColumnFrame &columns) {
+  if (ispec.eof())
+    return;
+  bool is_doubly;
+  double diameter, length;
+  double position[3], orientation[3];
+  int oid;
+  ispec.read(reinterpret_cast<char *>(&is_doubly), sizeof(bool));
+  ispec.read(reinterpret_cast<char *>(&diameter), sizeof(double));
+  ispec.read(reinterpret_cast<char *>(&length), sizeof(double));
+  ispec.read(reinterpret_cast<char *>(position), sizeof(position));
+  ispec.read(reinterpret_cast<char *>(orientation), sizeof(orientation));
+  ispec.read(reinterpret_cast<char *>(&oid), sizeof(int));
+  columns.Add("is_doubly", &is_doubly);
+  columns.Add("diameter", &diameter);
+  columns.Add("length", &length);
+  columns.Add("position", position, 3);
+  columns.Add("orientation", orientation, 3);
+  columns.Add("oid", &oid);
+  columns.BeginGroup("anchor");
+  for (int i = 0; i < 2; ++i) {
+    Anchor::ExportSpec(ispec, columns);
+  }
+  columns.EndGroup();
+}
+
+void Crosslink::ReadSpec(FrameReader &ispec) {
   if (ispec.eof())
     return;
   SetSingly(bound_anchor_);
@@ -468,13 +615,13 @@ void Crosslink::ReadSpec(std::fstream &ispec) {
   }
 }
 
-void Crosslink::WriteCheckpoint(std::fstream &ocheck) {
+void Crosslink::WriteCheckpoint(FrameBuffer &ocheck) {
   Object::WriteCheckpoint(ocheck);
   anchors_[0].WriteCheckpointHeader(ocheck);
   anchors_[1].WriteCheckpointHeader(ocheck);
 }
 
-void Crosslink::ReadCheckpoint(std::fstream &icheck) {
+void Crosslink::ReadCheckpoint(FrameReader &icheck) {
   Object::ReadCheckpoint(icheck);
   anchors_[0].ReadCheckpointHeader(icheck);
   anchors_[1].ReadCheckpointHeader(icheck);
@@ -517,10 +664,12 @@ void Crosslink::InsertAt(double const *const new_pos, double const *const u) {
   SetSingly(bound_anchor_);
 }
 
-void Crosslink::SetBindParamMap(std::vector<std::map<std::string, bind_params> > *bind_param_map) {
+void Crosslink::SetBindParamMap(std::vector<std::map<std::string, bind_params> > *bind_param_map,
+                                std::vector<std::vector<bind_params *> > *bind_param_ids) {
   bind_param_map_ = bind_param_map;
-  anchors_[0].SetBindParamMap(bind_param_map_);
-  anchors_[1].SetBindParamMap(bind_param_map_);
+  bind_param_ids_ = bind_param_ids;
+  anchors_[0].SetBindParamMap(bind_param_map_, bind_param_ids_);
+  anchors_[1].SetBindParamMap(bind_param_map_, bind_param_ids_);
 }
 
 void Crosslink::SetObjSize(double *obj_size) {
@@ -537,6 +686,11 @@ void Crosslink::SetBindRate(double *bind_rate) {
   anchors_[1].SetBindRate(bind_rate);
 }
 
+void Crosslink::SetOccupancyChanges(std::vector<Object *> *occupancy_changes) {
+  anchors_[0].SetOccupancyChanges(occupancy_changes);
+  anchors_[1].SetOccupancyChanges(occupancy_changes);
+}
+
 const double* const Crosslink::GetObjSize() {
   if (!obj_size_) Logger::Warning("Crosslink sent nullptr obj_size");
   return obj_size_;
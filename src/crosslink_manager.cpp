@@ -21,16 +21,22 @@ void CrosslinkManager::InitSpecies(sid_label &slab, ParamsParser &parser,
     delete xlink_species_.back();
     xlink_species_.pop_back();
   } else {
-    xlink_species_.back()->InitInteractionEnvironment(objs_, &obj_size_, tracker_,
-                                                      &update_, &bound_curr_);
+    xlink_species_.back()->InitInteractionEnvironment(
+        objs_, &obj_size_, &occupancy_changes_, tracker_, &update_);
     rcutoff_ = xlink_species_.back()->GetRCutoff();
   }
 }
 
 /* Keep track of volume of objects in the system. Affects the
- * probability of a free crosslink binding to an object. */
+ * probability of a free crosslink binding to an object. The amounts of each
+ * object name available for binding are tallied in the same pass to set
+ * the bind rates of species that use bind files, and each species refreshes
+ * the bind weights it draws targets from. Between passes, bind and unbind
+ * events adjust these totals and weights incrementally, so a pass is only
+ * needed when interactors are updated or their sizes change. */
 void CrosslinkManager::UpdateObjsSize() {
   obj_size_ = 0;
+  std::fill(obj_amounts_.begin(), obj_amounts_.end(), bind_amounts());
   for (auto it = objs_->begin(); it != objs_->end(); ++it) {
     switch ((*it)->GetShape()) {
       case shape::rod:
@@ -42,7 +48,25 @@ void CrosslinkManager::UpdateObjsSize() {
       default:
         break;
     }
+    int name_id = (*it)->GetNameID();
+    if (name_id >= (int)obj_amounts_.size()) {
+      obj_amounts_.resize(name_id + 1);
+    }
+    bind_amounts &amounts = obj_amounts_[name_id];
+    double length = (*it)->GetLength();
+    double area = (*it)->GetArea();
+    amounts.length += length;
+    amounts.area += area;
+    if ((*it)->GetNAnchored() == 0) {
+      amounts.free_length += length;
+      amounts.free_area += area;
+    }
+  }
+  for (auto it = xlink_species_.begin(); it != xlink_species_.end(); ++it) {
+    (*it)->UpdateBindRate(obj_amounts_);
+    (*it)->RefreshBindWeights();
   }
+  obj_size_update_ = false;
 }
 
 /* Whether to reinsert anchors into the interactors list */
@@ -71,27 +95,21 @@ void CrosslinkManager::GetAnchorInteractors(std::vector<Object *> &ixors) {
 
 void CrosslinkManager::UpdateCrosslinks() {
   update_ = false;
-  UpdateObjsSize();
+  if (obj_size_update_) {
+    UpdateObjsSize();
+  }
   for (auto it = xlink_species_.begin(); it != xlink_species_.end(); ++it) {
     (*it)->UpdatePositions();
-    (*it)->UpdateBindRate();
   }
-  Knockout();
-}
-
-// Loop over all spheres bound in the last dt. If multiple xlinks want to bind
-// to a site, roll based on their relative probabilities, and unbind all of the
-// "losers".
-void CrosslinkManager::Knockout() {
-  for (auto it = bound_curr_.begin(); it != bound_curr_.end(); ++it) {
-    // Add an anchor now that loop over xlinks is complete (collisions have
-    // already happened in this dt).
-    it->first->IncrementNAnchored();
-    if ((it->second.first).size()>1) {
-      Logger::Error("Anchor bound twice in Knockout");
-    }
+  /* Every species applies this step's occupancy changes to its bind weights
+     before they are cleared */
+  for (auto it = xlink_species_.begin(); it != xlink_species_.end(); ++it) {
+    (*it)->SyncBindWeights();
+  }
+  occupancy_changes_.clear();
+  for (auto it = xlink_species_.begin(); it != xlink_species_.end(); ++it) {
+    (*it)->ResetOccupancySync();
   }
-  bound_curr_.clear();
 }
 
 void CrosslinkManager::InsertCrosslinks() {
@@ -104,7 +122,6 @@ void CrosslinkManager::InsertAttachedCrosslinks() {
   // Need to do this for GetRandomObject to work with spheres
   UpdateObjsSize();
   for (auto it = xlink_species_.begin(); it != xlink_species_.end(); ++it) {
-    (*it)->UpdateBindRate();
     (*it)->InsertAttachedCrosslinksSpecies();
   }
 }
@@ -124,13 +141,70 @@ void CrosslinkManager::Draw(std::vector<graph_struct *> &graph_array) {
   }
 }
 
-void CrosslinkManager::AddNeighborToAnchor(Object *anchor, Object *neighbor) {
-  if (anchor->GetSID() != +species_id::crosslink) {
-    Logger::Error(
-        "AddNeighborToAnchor expected crosslink object, got generic object.");
+/* Fill anchor neighbor lists from the pair list in bulk. One pass writes an
+   (anchor, target) record for every crosslink pair that survived the
+   interaction filters, and sorting the records groups them by anchor, rods
+   before spheres, by OID. Each anchor then receives its contiguous span in a
+   fixed order, independent of how the pair list was split between threads. */
+void CrosslinkManager::BuildAnchorNeighbors(
+    std::vector<Interaction> const &pairs) {
+  anchor_neighbors_.clear();
+  for (auto ix = pairs.begin(); ix != pairs.end(); ++ix) {
+    if (ix->no_interaction) {
+      continue;
+    }
+    Object *anchor = ix->obj1;
+    Object *target = ix->obj2;
+    if (target->GetSID() == +species_id::crosslink) {
+      std::swap(anchor, target);
+    } else if (anchor->GetSID() != +species_id::crosslink) {
+      continue;
+    }
+    /* Only anchors carry the crosslink SID among interactors, and only Rod
+       and Sphere set these shapes, so static casts are safe here */
+    anchor_neighbor nbr = {static_cast<Anchor *>(anchor), nullptr, nullptr,
+                           target->GetOID()};
+    switch (target->GetShape()) {
+      case shape::rod:
+        nbr.rod = static_cast<const Rod *>(target);
+        break;
+      case shape::sphere:
+        /* Occupied spheres are not available for binding */
+        if (target->GetNAnchored() > 0) {
+          continue;
+        }
+        nbr.sphere = static_cast<const Sphere *>(target);
+        break;
+      default:
+        continue;
+    }
+    anchor_neighbors_.push_back(nbr);
+  }
+  std::sort(anchor_neighbors_.begin(), anchor_neighbors_.end(),
+            [](anchor_neighbor const &a, anchor_neighbor const &b) {
+              int a_oid = a.anchor->GetOID();
+              int b_oid = b.anchor->GetOID();
+              if (a_oid != b_oid) {
+                return a_oid < b_oid;
+              }
+              if ((a.rod == nullptr) != (b.rod == nullptr)) {
+                return a.rod != nullptr;
+              }
+              return a.target_oid < b.target_oid;
+            });
+  Anchor *current = nullptr;
+  for (auto nbr = anchor_neighbors_.begin(); nbr != anchor_neighbors_.end();
+       ++nbr) {
+    if (nbr->anchor != current) {
+      current = nbr->anchor;
+      current->ClearNeighbors();
+    }
+    if (nbr->rod) {
+      current->AddNeighbor(nbr->rod);
+    } else {
+      current->AddNeighbor(nbr->sphere);
+    }
   }
-  Anchor *a = dynamic_cast<Anchor *>(anchor);
-  a->AddNeighbor(neighbor);
 }
 
 void CrosslinkManager::InitOutputs(bool reading_inputs, run_options *run_opts) {
@@ -173,3 +247,4 @@ void CrosslinkManager::LoadCrosslinksFromCheckpoints(
 
 void CrosslinkManager::ReadInputs() { output_mgr_.ReadInputs(); }
 void CrosslinkManager::Convert() { output_mgr_.Convert(); }
+void CrosslinkManager::ExportColumns() { output_mgr_.ExportColumns(); }
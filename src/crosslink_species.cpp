@@ -1,6 +1,9 @@
 #include "cglass/crosslink_species.hpp"
 
+std::map<std::string, lut_cache_entry> CrosslinkSpecies::_lut_cache_;
+
 CrosslinkSpecies::CrosslinkSpecies(unsigned long seed) : Species(seed), bind_param_map_(2),
+                                                         bind_param_ids_(2),
                                                          default_bind_params_(2) {
   SetSID(species_id::crosslink);
 }
@@ -90,30 +93,55 @@ void CrosslinkSpecies::LoadBindingSpecies() {
 
 void CrosslinkSpecies::AddMember() {
   Species::AddMember();
-  members_.back().InitInteractionEnvironment(&lut_, tracker_, bound_curr_);
+  members_.back().InitInteractionEnvironment(&lut_, tracker_);
   members_.back().SetObjSize(obj_size_);
   members_.back().SetBindRate(&bind_rate_);
-  members_.back().SetBindParamMap(&bind_param_map_);
-  *update_ = true;
+  members_.back().SetOccupancyChanges(occupancy_changes_);
+  members_.back().SetBindParamMap(&bind_param_map_, &bind_param_ids_);
+  SetBindingChanged();
 }
 
-void CrosslinkSpecies::InitInteractionEnvironment(std::vector<Object *> *objs,
-                                                  double *obj_size,
-                                                  Tracker *tracker, bool *update,
-                       std::map<Sphere *, std::pair<std::vector<double>, std::vector<Anchor*> > > *bound_curr) {
+void CrosslinkSpecies::InitInteractionEnvironment(
+    std::vector<Object *> *objs, double *obj_size,
+    std::vector<Object *> *occupancy_changes, Tracker *tracker, bool *update) {
   objs_ = objs;
   obj_size_ = obj_size;
-  bound_curr_ = bound_curr;
+  occupancy_changes_ = occupancy_changes;
   update_ = update;
   tracker_ = tracker;
-  LUTFiller *lut_filler_ptr = MakeLUTFiller();
-  lut_ = LookupTable(lut_filler_ptr);
-  if (sparams_.use_binding_volume) {
-    lut_.setBindVol(lut_filler_ptr->getBindingVolume());
-  }
+  InitLookupTable();
   /* TODO: Add time testing right here <24-06-20, ARL> */
   TestKMCStepSize();
-  delete lut_filler_ptr;
+}
+
+/* Every input that determines the contents of the lookup table, printed at
+   full precision so that equal keys mean identical tables */
+std::string CrosslinkSpecies::GetLUTKey() const {
+  std::ostringstream key;
+  key << std::setprecision(17) << sparams_.lut_grid_num << " "
+      << sparams_.k_spring << " " << sparams_.k_spring_compress << " "
+      << sparams_.energy_dep_factor << " " << sparams_.force_dep_length << " "
+      << sparams_.rest_length;
+  return key.str();
+}
+
+void CrosslinkSpecies::InitLookupTable() {
+  std::string key = GetLUTKey();
+  auto it = _lut_cache_.find(key);
+  if (it == _lut_cache_.end()) {
+    LUTFiller *lut_filler_ptr = MakeLUTFiller();
+    lut_cache_entry entry = {LookupTable(lut_filler_ptr),
+                             lut_filler_ptr->getBindingVolume()};
+    delete lut_filler_ptr;
+    it = _lut_cache_.insert(std::make_pair(key, entry)).first;
+  } else {
+    Logger::Debug("Reusing crosslink lookup table for %s",
+                  GetSpeciesName().c_str());
+  }
+  lut_ = it->second.lut;
+  if (sparams_.use_binding_volume) {
+    lut_.setBindVol(it->second.bind_volume);
+  }
 }
 
 /*! \brief Test simulation step size to make sure KMC will work properly.
@@ -280,14 +308,17 @@ void CrosslinkSpecies::InsertAttachedCrosslinksSpecies() {
   if (begin_with_bound_crosslinks_<=0) {
     return;
   }
+  bind_weights_stale_ = true;
   Crosslink xlink(rng_.GetSeed());
   xlink.Init(&sparams_);
-  xlink.InitInteractionEnvironment(&lut_, tracker_, bound_curr_);
+  xlink.InitInteractionEnvironment(&lut_, tracker_);
   xlink.SetObjSize(obj_size_);
   xlink.SetBindRate(&bind_rate_);
-  xlink.SetBindParamMap(&bind_param_map_);
+  xlink.SetOccupancyChanges(occupancy_changes_);
+  xlink.SetBindParamMap(&bind_param_map_, &bind_param_ids_);
   xlink.SetSID(GetSID());
   members_.resize(begin_with_bound_crosslinks_, xlink);
+  SetMembersChanged();
   UpdateBoundCrosslinks();
   // Begin with bound crosslinks currently just implemented to start on rods
   for (int i=0; i < begin_with_bound_crosslinks_; ++i) {
@@ -310,7 +341,8 @@ void CrosslinkSpecies::CalculateBindingFree() {
     free_concentration = (sparams_.num - n_members_) / space_->volume;
   }
   if (use_bind_file_) {
-    int num_to_bind = rng_.RandomPoisson(free_concentration * params_->delta * bind_rate_);
+    int num_to_bind = DrawFreeBindNumber(free_concentration * params_->delta *
+                                         bind_rate_);
     for (int i = 0; i < num_to_bind; ++i) {
       BindCrosslink();
     }
@@ -318,7 +350,7 @@ void CrosslinkSpecies::CalculateBindingFree() {
     double expected_bind_n = bind_site_density_ * free_concentration *
                        (*obj_size_) * k_on_ * params_->delta;
     // Use a Poisson distribution to calculate the number of particles
-    int bind_num = rng_.RandomPoisson(expected_bind_n);
+    int bind_num = DrawFreeBindNumber(expected_bind_n);
     // Track US probabilities
     tracker_->TrackUS(expected_bind_n);
     tracker_->BindUS(bind_num);
@@ -330,70 +362,175 @@ void CrosslinkSpecies::CalculateBindingFree() {
   }
 }
 
-/* Returns a random object with selection probability proportional to object
-   bind rate. */
-std::pair <Object*, int> CrosslinkSpecies::GetRandomObject() {
+/* Number of crosslinks binding from solution this step. With event-driven
+   kinetics a binding fires each time the accumulated expected number passes an
+   exponential threshold, which has the same Poisson statistics but draws no
+   random numbers on steps where nothing binds. */
+int CrosslinkSpecies::DrawFreeBindNumber(double expected_bind_n) {
+  if (!sparams_.event_driven_kinetics) {
+    return rng_.RandomPoisson(expected_bind_n);
+  }
+  if (free_bind_clock_ < 0) {
+    free_bind_clock_ = rng_.RandomExponential(1);
+  }
+  int bind_num = 0;
+  while (expected_bind_n >= free_bind_clock_) {
+    expected_bind_n -= free_bind_clock_;
+    free_bind_clock_ = rng_.RandomExponential(1);
+    bind_num++;
+  }
+  free_bind_clock_ -= expected_bind_n;
+  return bind_num;
+}
+
+/* Event clocks are written after all members, so that checkpoints keep the
+   same member records whether or not kinetics are event-driven */
+void CrosslinkSpecies::WriteCheckpointState(FrameBuffer &ocheck) {
+  ocheck.write(reinterpret_cast<char *>(&free_bind_clock_), sizeof(double));
+  for (auto xlink = members_.begin(); xlink != members_.end(); ++xlink) {
+    ocheck.write(reinterpret_cast<const char *>(xlink->GetEventClocks()),
+                 2 * sizeof(double));
+  }
+}
+
+/* Checkpoints written without the clocks leave them to be redrawn */
+void CrosslinkSpecies::ReadCheckpointState(FrameReader &icheck) {
+  SetMembersChanged();
+  icheck.read(reinterpret_cast<char *>(&free_bind_clock_), sizeof(double));
+  double clocks[2];
+  for (auto xlink = members_.begin(); xlink != members_.end(); ++xlink) {
+    if (!icheck.eof()) {
+      icheck.read(reinterpret_cast<char *>(clocks), 2 * sizeof(double));
+    }
+    if (icheck.eof()) {
+      xlink->ResetEventClocks();
+    } else {
+      xlink->SetEventClocks(clocks);
+    }
+  }
+  if (icheck.eof()) {
+    free_bind_clock_ = -1;
+  }
+}
+
+/* Rate weight for an anchor binding to an object, which is the area/length
+   of the object for the default binding parameters */
+double CrosslinkSpecies::CalcBindWeight(Object *obj, int anchor_index,
+                                        bool occupied) {
   if (use_bind_file_) {
-    double bind_rate_sum = 0;
-    std::string name = "";
-    // Roll to choose object
-    double roll = bind_rate_*rng_.RandomUniform();
-    // Count up bind rates to pick correct object
-    for (int anchor_index = 0; anchor_index < 2; ++anchor_index) {
-      for (auto obj = objs_->begin(); obj != objs_->end(); ++obj) {
-        name = (*obj)->GetName();
-        auto bind_param_it = bind_param_map_[anchor_index].find(name);
-        // Do not count objects that are not in bind_param_map
-        if (bind_param_it == bind_param_map_[anchor_index].end()) continue;
-        // obj_amount is area if surface density used, length if linear density used
-        double obj_amount = (bind_param_it->second.dens_type == +density_type::linear) 
-                            ? (*obj)->GetLength() : (*obj)->GetArea();
-        // Do not contribute area/length if object is already occupied and single occupancy is
-        // selected
-        if (bind_param_it->second.single_occupancy && ((*obj)->GetNAnchored() > 0)) {
-          obj_amount = 0;
-        }
-        bind_rate_sum += bind_param_it->second.k_on_s * 
-                         bind_param_it->second.bind_site_density * obj_amount;
-        if (bind_rate_sum > roll) {
-          Logger::Trace("Binding free crosslink to random object: xl %d -> obj %d",
-                        members_.back().GetOID(), (*obj)->GetOID());
-          return std::make_pair(*obj, anchor_index);
-        }
-      }
+    bind_params *bparams = FindBindParams(bind_param_map_[anchor_index],
+                                          bind_param_ids_[anchor_index], obj);
+    // Do not count objects that are not in bind_param_map
+    if (!bparams) return 0;
+    // Do not contribute area/length if object is already occupied and single
+    // occupancy is selected
+    if (bparams->single_occupancy && occupied) return 0;
+    // obj_amount is area if surface density used, length if linear density used
+    double obj_amount = (bparams->dens_type == +density_type::linear)
+                            ? obj->GetLength()
+                            : obj->GetArea();
+    return bparams->k_on_s * bparams->bind_site_density * obj_amount;
+  }
+  switch (obj->GetShape()) {
+    case shape::rod:
+      return obj->GetLength();
+    case shape::sphere:
+      return (occupied ? 0 : obj->GetArea());
+    default:
+      return 0;
+  }
+}
+
+/* Weights are stored as all objects for the first anchor followed by all
+   objects for the second anchor */
+void CrosslinkSpecies::BuildBindWeights() {
+  int n_objs = objs_->size();
+  std::vector<double> weights(2 * n_objs);
+  bind_weight_index_.clear();
+  for (int i = 0; i < n_objs; ++i) {
+    Object *obj = (*objs_)[i];
+    bind_weight_index_[obj->GetOID()] = i;
+    bool occupied = obj->GetNAnchored() > 0;
+    weights[i] = CalcBindWeight(obj, 0, occupied);
+    weights[n_objs + i] = CalcBindWeight(obj, 1, occupied);
+  }
+  bind_weights_.Build(weights);
+  bind_weights_stale_ = false;
+  n_occupancy_synced_ = occupancy_changes_->size();
+}
+
+/* Recalculate the bind weights of the object at index i of the weights */
+void CrosslinkSpecies::UpdateObjBindWeights(Object *obj, int i) {
+  int n_objs = bind_weights_.Size() / 2;
+  bool occupied = obj->GetNAnchored() > 0;
+  for (int anchor_index = 0; anchor_index < 2; ++anchor_index) {
+    double weight = CalcBindWeight(obj, anchor_index, occupied);
+    if (weight != bind_weights_.GetWeight(anchor_index * n_objs + i)) {
+      bind_weights_.SetWeight(anchor_index * n_objs + i, weight);
     }
-    Logger::Error("Crosslinks tried to bind to more sites than available- lower timestep.");
-    return std::make_pair(nullptr, -1);
-  } else {
-    // 2x factor comes from 2 anchors
-    double roll = 2*rng_.RandomUniform()*(*obj_size_);
-    double vol = 0;
-
-    // Search through interactors to find an object of shape sh
-    for (int anchor_index = 0; anchor_index < 2; ++anchor_index) {
-      for (auto obj = objs_->begin(); obj != objs_->end(); ++obj) {
-        switch((*obj)->GetShape()) {
-          case shape::rod:
-            vol += (*obj)->GetLength();
-            break;
-          case shape::sphere:
-            if ((*obj)->GetNAnchored()==0) {
-              vol += (*obj)->GetArea();
-            }
-            break;
-          default:
-            break;
-        }
-        if (vol > roll) {
-          Logger::Trace("Binding free crosslink to random object: xl %d -> obj %d",
-                        members_.back().GetOID(), (*obj)->GetOID());
-          return std::make_pair(*obj, anchor_index);
-        }
+  }
+}
+
+/* Called by the crosslink manager whenever object sizes are recounted. Sizes
+   are updated in place unless objects were added, removed or reordered, in
+   which case the weights are rebuilt before the next draw. */
+void CrosslinkSpecies::RefreshBindWeights() {
+  int n_objs = objs_->size();
+  if (bind_weights_stale_ || bind_weights_.Size() != 2 * n_objs) {
+    bind_weights_stale_ = true;
+    return;
+  }
+  for (int i = 0; i < n_objs; ++i) {
+    auto it = bind_weight_index_.find((*objs_)[i]->GetOID());
+    if (it == bind_weight_index_.end() || it->second != i) {
+      bind_weights_stale_ = true;
+      return;
+    }
+    UpdateObjBindWeights((*objs_)[i], i);
+  }
+  n_occupancy_synced_ = occupancy_changes_->size();
+}
+
+/* Apply occupancy changes logged by any crosslink species since the last
+   sync */
+void CrosslinkSpecies::SyncBindWeights() {
+  if (!bind_weights_stale_) {
+    for (size_t i = n_occupancy_synced_; i < occupancy_changes_->size(); ++i) {
+      Object *obj = (*occupancy_changes_)[i];
+      auto it = bind_weight_index_.find(obj->GetOID());
+      if (it != bind_weight_index_.end()) {
+        UpdateObjBindWeights(obj, it->second);
       }
     }
+  }
+  n_occupancy_synced_ = occupancy_changes_->size();
+}
+
+/* Returns a random object with selection probability proportional to object
+   bind rate. */
+std::pair <Object*, int> CrosslinkSpecies::GetRandomObject() {
+  if (bind_weights_stale_ || bind_weights_.Size() != 2 * (int)objs_->size()) {
+    BuildBindWeights();
+  } else {
+    SyncBindWeights();
+  }
+  int i_weight = bind_weights_.Find(bind_weights_.Total() * rng_.RandomUniform());
+  /* Partial sums drift as weights are updated between rebuilds, so rebuild
+     and redraw if an empty slot was picked */
+  if (i_weight >= 0 && bind_weights_.GetWeight(i_weight) <= 0) {
+    BuildBindWeights();
+    i_weight = bind_weights_.Find(bind_weights_.Total() * rng_.RandomUniform());
+  }
+  if (i_weight < 0) {
     Logger::Error("Crosslinks tried to bind to more sites than available- lower timestep.");
     return std::make_pair(nullptr, -1);
   }
+  int n_objs = objs_->size();
+  int anchor_index = i_weight / n_objs;
+  Object *obj = (*objs_)[i_weight % n_objs];
+  Logger::Trace("Binding free crosslink to random object: xl %d -> obj %d",
+                members_.back().GetOID(), obj->GetOID());
+  return std::make_pair(obj, anchor_index);
 }
 
 /* A crosslink binds to an object from solution */
@@ -439,56 +576,331 @@ void CrosslinkSpecies::UpdatePositions() {
   //}
 }
 
-void CrosslinkSpecies::UpdateBindRate() {
+/* Index binding parameters by interned object name so that per-object
+   lookups avoid string comparisons */
+void CrosslinkSpecies::UpdateBindParamIDs() {
+  for (int anchor_index = 0; anchor_index < 2; ++anchor_index) {
+    auto &by_name = bind_param_map_[anchor_index];
+    auto &by_id = bind_param_ids_[anchor_index];
+    for (auto it = by_name.begin(); it != by_name.end(); ++it) {
+      Object::InternName(it->first);
+    }
+    by_id.assign(Object::GetNNames(), nullptr);
+    for (auto it = by_name.begin(); it != by_name.end(); ++it) {
+      by_id[Object::InternName(it->first)] = &it->second;
+    }
+  }
+}
+
+/* Total binding rate from the amount of objects of each name available for
+   binding, which is tallied by the crosslink manager */
+void CrosslinkSpecies::UpdateBindRate(std::vector<bind_amounts> const &amounts) {
   if (!use_bind_file_) return;  
+  UpdateBindParamIDs();
   bind_rate_ = 0;
   for (int anchor_index = 0; anchor_index < 2; ++anchor_index) {
-    for (auto obj = objs_->begin(); obj != objs_->end(); ++obj) {
-      std::string name = (*obj)->GetName();
-      // Find if name of object is in the map
-      auto bind_param_it = bind_param_map_[anchor_index].find(name);
-      if (bind_param_it != bind_param_map_[anchor_index].end()) {
-        // obj_amount is area if surface density used, length if linear density used
-        double obj_amount = (bind_param_it->second.dens_type == +density_type::linear) 
-                            ? (*obj)->GetLength() : (*obj)->GetArea();
-        // Do not contribute area/length if object is already occupied and single occupancy is
-        // selected
-        if (bind_param_it->second.single_occupancy && ((*obj)->GetNAnchored() > 0)) {
-          obj_amount = 0;
-        }
-        bind_rate_ += bind_param_it->second.k_on_s * 
-                      bind_param_it->second.bind_site_density * obj_amount;
+    auto &by_id = bind_param_ids_[anchor_index];
+    for (int name_id = 0; name_id < (int)amounts.size(); ++name_id) {
+      if (name_id >= (int)by_id.size() || !by_id[name_id]) continue;
+      bind_params const *bparams = by_id[name_id];
+      // obj_amount is area if surface density used, length if linear density used.
+      // Do not contribute area/length of occupied objects if single occupancy is
+      // selected
+      double obj_amount;
+      if (bparams->dens_type == +density_type::linear) {
+        obj_amount = (bparams->single_occupancy ? amounts[name_id].free_length
+                                                : amounts[name_id].length);
+      } else {
+        obj_amount = (bparams->single_occupancy ? amounts[name_id].free_area
+                                                : amounts[name_id].area);
       }
+      bind_rate_ += bparams->k_on_s * bparams->bind_site_density * obj_amount;
     }
   }
 }
 
 void CrosslinkSpecies::UpdateBoundCrosslinks() {
   n_members_ = 0;
+  /* Group anchors by the mesh they move along */
+  BuildMotorTracks();
   /* Update anchor positions to their attached meshes and calculate anchor
      forces */
+  UpdateMotorTracks(false);
   UpdateBoundCrosslinkForces();
   /* Apply anchor forces on bound objects sequentially */
   ApplyCrosslinkTetherForces();
   /* Update anchor positions from diffusion, walking */
+  if (!sparams_.stationary_flag) {
+    UpdateMotorTracks(true);
+  }
   UpdateBoundCrosslinkPositions();
-  /* Remove crosslinks that came unbound */
+  ClearMotorTracks();
+  /* Resolve crosslinks competing to bind the same sphere */
+  CommitSphereBindings();
+  /* Apply bind rate changes from binding and unbinding in crosslink order */
+  for (auto xlink = members_.begin(); xlink != members_.end(); ++xlink) {
+    xlink->FlushBindRates();
+  }
+  /* Remove crosslinks that came unbound by moving the last crosslink into
+     their place. Anchors live in storage owned by each crosslink, so moving
+     a crosslink does not invalidate pointers to its anchors. */
   if (!sparams_.static_flag) {
-    members_.erase(std::remove_if(members_.begin(), members_.end(),
-                                  [](Crosslink x) { return x.IsUnbound(); }),
-                   members_.end());
+    for (size_t i = 0; i < members_.size();) {
+      if (members_[i].IsUnbound()) {
+        if (i != members_.size() - 1) {
+          members_[i] = std::move(members_.back());
+        }
+        members_.pop_back();
+      } else {
+        ++i;
+      }
+    }
   }
   /* Get the number of bound crosslinks so we know what the current
      concentration of free crosslinks is */
   n_members_ = members_.size();
 }
 
-/* This must be done sequentially to avoid racy conditions when accessing
-   bound object's forces */
+/* Split groups of items, where group i spans [offsets[i], offsets[i + 1]),
+   into n_chunks contiguous ranges of groups holding about the same number of
+   items. A group goes to the chunk that holds its midpoint. */
+static void BalanceChunks(std::vector<int> const &offsets, int n_chunks,
+                          std::vector<std::pair<int, int>> &chunks) {
+  int n_groups = offsets.size() - 1;
+  long total = offsets.back();
+  chunks.clear();
+  int i_group = 0;
+  for (int i = 0; i < n_chunks; ++i) {
+    int first = i_group;
+    long target = total * (i + 1) / n_chunks;
+    while (i_group < n_groups &&
+           offsets[i_group] + offsets[i_group + 1] <= 2 * target) {
+      ++i_group;
+    }
+    chunks.push_back(std::make_pair(first, i_group));
+  }
+  chunks.back().second = n_groups;
+}
+
+/* Gather anchors bound to mesh bonds into one track per mesh, sorted by mesh
+   lambda, so that each mesh's anchors can be moved in a single sweep. Tracks
+   only gain or lose anchors when crosslinks bind or unbind, so they are kept
+   between steps until then, and the sweeps restore their order as anchors
+   walk past each other. */
+void CrosslinkSpecies::BuildMotorTracks() {
+#ifdef ENABLE_OPENMP
+  int max_threads = omp_get_max_threads();
+#else
+  int max_threads = 1;
+#endif
+  if (motor_tracks_stale_ || (int)motor_track_chunks_.size() != max_threads) {
+    motor_tracks_.clear();
+    motor_track_offsets_.clear();
+    for (auto xlink = members_.begin(); xlink != members_.end(); ++xlink) {
+      for (int i = 0; i < 2; ++i) {
+        Anchor *anchor = xlink->GetAnchor(i);
+        if (anchor->GetTrackMesh()) {
+          motor_tracks_.push_back(anchor);
+        }
+      }
+    }
+    std::sort(motor_tracks_.begin(), motor_tracks_.end(),
+              [](Anchor *a, Anchor *b) {
+                int a_mesh = a->GetTrackMesh()->GetOID();
+                int b_mesh = b->GetTrackMesh()->GetOID();
+                if (a_mesh != b_mesh) {
+                  return a_mesh < b_mesh;
+                }
+                return a->GetMeshLambda() < b->GetMeshLambda();
+              });
+    Mesh *current = nullptr;
+    for (size_t i = 0; i < motor_tracks_.size(); ++i) {
+      if (motor_tracks_[i]->GetTrackMesh() != current) {
+        current = motor_tracks_[i]->GetTrackMesh();
+        motor_track_offsets_.push_back(i);
+      }
+    }
+    motor_track_offsets_.push_back(motor_tracks_.size());
+    BalanceChunks(motor_track_offsets_, max_threads, motor_track_chunks_);
+    motor_tracks_stale_ = false;
+  }
+  for (auto anchor = motor_tracks_.begin(); anchor != motor_tracks_.end();
+       ++anchor) {
+    (*anchor)->SetOnTrack(true);
+  }
+}
+
+/* Sweep every track, either placing anchors on their bonds or letting them
+   diffuse and walk. Tracks are independent, so they run in parallel, with
+   chunks of tracks balanced by their number of anchors. */
+void CrosslinkSpecies::UpdateMotorTracks(bool walk) {
+  auto sweep = [this, walk](int i_track) {
+    int first = motor_track_offsets_[i_track];
+    int last = motor_track_offsets_[i_track + 1];
+    /* Anchors only move a little each step, so an insertion sort restores
+       the order of a kept track in about one pass */
+    if (!walk) {
+      for (int i = first + 1; i < last; ++i) {
+        Anchor *anchor = motor_tracks_[i];
+        double lambda = anchor->GetMeshLambda();
+        int j = i;
+        for (; j > first && motor_tracks_[j - 1]->GetMeshLambda() > lambda;
+             --j) {
+          motor_tracks_[j] = motor_tracks_[j - 1];
+        }
+        motor_tracks_[j] = anchor;
+      }
+    }
+    int i_bond = 0;
+    for (int i = first; i < last; ++i) {
+      Anchor *anchor = motor_tracks_[i];
+      /* Anchors that fell off their mesh are no longer on the track */
+      if (!anchor->IsOnTrack()) {
+        continue;
+      }
+      if (walk) {
+        anchor->UpdatePositionOnTrack();
+      } else {
+        anchor->UpdateAnchorPositionToTrack(i_bond);
+      }
+    }
+  };
+#ifdef ENABLE_OPENMP
+  int max_threads = motor_track_chunks_.size();
+#pragma omp parallel
+  {
+#pragma omp for
+    for (int i = 0; i < max_threads; ++i) {
+      for (int i_track = motor_track_chunks_[i].first;
+           i_track < motor_track_chunks_[i].second; ++i_track) {
+        sweep(i_track);
+      }
+    }
+  }
+#else
+  int n_tracks = motor_track_offsets_.size() - 1;
+  for (int i_track = 0; i_track < n_tracks; ++i_track) {
+    sweep(i_track);
+  }
+#endif
+}
+
+/* Hand anchors back to their crosslinks once the track sweeps are done */
+void CrosslinkSpecies::ClearMotorTracks() {
+  for (auto anchor = motor_tracks_.begin(); anchor != motor_tracks_.end();
+       ++anchor) {
+    (*anchor)->SetOnTrack(false);
+  }
+}
+
+/* Crosslinks choose binding targets in parallel, but spheres may only hold
+   one anchor. Proposals are gathered in crosslink order and each contested
+   sphere goes to one crosslink chosen in proportion to its binding
+   probability, so the outcome is independent of the number of threads.
+   Contested spheres are resolved in order of sphere OID rather than address,
+   so the random draws are reproducible between runs. Spheres already
+   occupied (e.g. by another crosslink species this step) reject all
+   proposals. */
+void CrosslinkSpecies::CommitSphereBindings() {
+  std::map<int, std::vector<Crosslink *> > proposals;
+  for (auto xlink = members_.begin(); xlink != members_.end(); ++xlink) {
+    if (xlink->GetSphereProposal()) {
+      proposals[xlink->GetSphereProposal()->GetOID()].push_back(&(*xlink));
+    }
+  }
+  for (auto it = proposals.begin(); it != proposals.end(); ++it) {
+    std::vector<Crosslink *> &xlinks = it->second;
+    int winner = -1;
+    if (xlinks[0]->GetSphereProposal()->GetNAnchored() == 0) {
+      winner = 0;
+      if (xlinks.size() > 1) {
+        double prob_tot = 0;
+        for (auto xl = xlinks.begin(); xl != xlinks.end(); ++xl) {
+          prob_tot += (*xl)->GetSphereProposalProb();
+        }
+        double roll = prob_tot * rng_.RandomUniform();
+        double prob_sum = 0;
+        for (winner = 0; winner < (int)xlinks.size() - 1; ++winner) {
+          prob_sum += xlinks[winner]->GetSphereProposalProb();
+          if (prob_sum > roll) break;
+        }
+      }
+    }
+    for (int i = 0; i < (int)xlinks.size(); ++i) {
+      if (i == winner) {
+        xlinks[i]->CommitSphereProposal();
+        SetBindingChanged();
+      } else {
+        xlinks[i]->ClearSphereProposal();
+      }
+    }
+  }
+}
+
+/* Group anchors of doubly-bound crosslinks by the composite they are bound to,
+   in crosslink order within each group. Groups only change when crosslinks
+   bind, unbind or move within members_, so they are kept between steps until
+   then. */
+void CrosslinkSpecies::BuildTetherGroups() {
+  tether_anchors_.clear();
+  tether_offsets_.clear();
+  for (auto xlink = members_.begin(); xlink != members_.end(); ++xlink) {
+    if (!xlink->IsDoubly()) {
+      continue;
+    }
+    for (int i = 0; i < 2; ++i) {
+      Anchor *anchor = xlink->GetAnchor(i);
+      if (anchor->IsBound() && anchor->GetComp()) {
+        tether_anchors_.push_back(
+            std::make_pair(anchor->GetComp()->GetOID(), anchor));
+      }
+    }
+  }
+  std::stable_sort(
+      tether_anchors_.begin(), tether_anchors_.end(),
+      [](std::pair<int, Anchor *> const &a, std::pair<int, Anchor *> const &b) {
+        return a.first < b.first;
+      });
+  for (size_t i = 0; i < tether_anchors_.size(); ++i) {
+    if (i == 0 || tether_anchors_[i].first != tether_anchors_[i - 1].first) {
+      tether_offsets_.push_back(i);
+    }
+  }
+  tether_offsets_.push_back(tether_anchors_.size());
+  tether_groups_stale_ = false;
+}
+
+/* Anchors add tether forces directly into the objects they are bound to,
+   which may be shared between crosslinks. Objects of a composite only receive
+   forces from anchors bound to that composite, so composites are handled in
+   parallel, with chunks of composites balanced by their number of anchors.
+   Within a composite, anchors are applied in crosslink order, which adds
+   forces to each object in the same order as the sequential loop. */
 void CrosslinkSpecies::ApplyCrosslinkTetherForces() {
+#ifdef ENABLE_OPENMP
+  int max_threads = omp_get_max_threads();
+  if (tether_groups_stale_ || (int)tether_chunks_.size() != max_threads) {
+    BuildTetherGroups();
+    BalanceChunks(tether_offsets_, max_threads, tether_chunks_);
+  }
+#pragma omp parallel
+  {
+#pragma omp for
+    for (int i = 0; i < max_threads; ++i) {
+      for (int i_group = tether_chunks_[i].first;
+           i_group < tether_chunks_[i].second; ++i_group) {
+        for (int j = tether_offsets_[i_group]; j < tether_offsets_[i_group + 1];
+             ++j) {
+          tether_anchors_[j].second->ApplyAnchorForces();
+        }
+      }
+    }
+  }
+#else
   for (auto xlink = members_.begin(); xlink != members_.end(); ++xlink) {
     xlink->ApplyTetherForces();
   }
+#endif
 }
 
 void CrosslinkSpecies::UpdateBoundCrosslinkForces() {
@@ -516,7 +928,7 @@ void CrosslinkSpecies::UpdateBoundCrosslinkForces() {
         }
         xlink->UpdateCrosslinkForces();
         if (xlink->IsSingly() != init_state) {
-          *update_ = true;
+          SetBindingChanged();
         }
       }
     }
@@ -530,7 +942,7 @@ void CrosslinkSpecies::UpdateBoundCrosslinkForces() {
     }
     xlink->UpdateCrosslinkForces();
     if (xlink->IsSingly() != init_state) {
-      *update_ = true;
+      SetBindingChanged();
     }
   }
 #endif
@@ -565,11 +977,11 @@ void CrosslinkSpecies::UpdateBoundCrosslinkPositions() {
           if (sparams_.static_flag) {
             Logger::Error("Static crosslinks became unbound");
           }
-          *update_ = true;
+          SetBindingChanged();
           /* If a crosslink enters or leaves the singly state, we need to
            * update xlink interactors */
         } else if (xlink->IsSingly() != init_state) {
-          *update_ = true;
+          SetBindingChanged();
         }
       }
     }
@@ -587,17 +999,20 @@ void CrosslinkSpecies::UpdateBoundCrosslinkPositions() {
       if (sparams_.static_flag) {
         Logger::Error("Static crosslinks became unbound");
       }
-      *update_ = true;
+      SetBindingChanged();
       /* If a crosslink enters or leaves the singly state, we need to update
        * xlink interactors */
     } else if (xlink->IsSingly() != init_state) {
-      *update_ = true;
+      SetBindingChanged();
     }
   }
 #endif
 }
 
-void CrosslinkSpecies::CleanUp() { members_.clear(); }
+void CrosslinkSpecies::CleanUp() {
+  members_.clear();
+  SetMembersChanged();
+}
 
 void CrosslinkSpecies::Draw(std::vector<graph_struct *> &graph_array) {
   for (auto it = members_.begin(); it != members_.end(); ++it) {
@@ -637,16 +1052,21 @@ void CrosslinkSpecies::ReadSpecs() {
   }
   if (n_members_ == 0) {
     members_.clear();
-  } else if (n_members_ != members_.size()) {
+  } else if (n_members_ < (int)members_.size()) {
+    members_.erase(members_.begin() + n_members_, members_.end());
+  } else if (n_members_ > (int)members_.size()) {
+    /* Only build a template member if new members are needed */
     Crosslink xlink(rng_.GetSeed());
     xlink.Init(&sparams_);
-    xlink.InitInteractionEnvironment(&lut_, tracker_, bound_curr_);
+    xlink.InitInteractionEnvironment(&lut_, tracker_);
     xlink.SetObjSize(obj_size_);
     xlink.SetBindRate(&bind_rate_);
-    xlink.SetBindParamMap(&bind_param_map_);
+    xlink.SetOccupancyChanges(occupancy_changes_);
+    xlink.SetBindParamMap(&bind_param_map_, &bind_param_ids_);
     xlink.SetSID(GetSID());
     members_.resize(n_members_, xlink);
   }
+  SetMembersChanged();
   for (auto it = members_.begin(); it != members_.end(); ++it) {
     it->ReadSpec(ispec_file_);
   }
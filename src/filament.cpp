@@ -6,7 +6,7 @@ Filament::Filament(unsigned long seed) : Mesh(seed) {
 void Filament::SetParameters() {
   /* Read parameters from filament parameters */
   color_ = sparams_->color;
-  name_ = sparams_->name;
+  SetName(sparams_->name);
   draw_ = draw_type::_from_string(sparams_->draw_type.c_str());
   length_ = sparams_->length;
   no_midstep_ = params_->no_midstep;
@@ -81,6 +81,12 @@ void Filament::SetParameters() {
   trapped_site_ = 0;
   custom_set_tail_ = sparams_->custom_set_tail;
   error_analysis_ = sparams_->error_analysis;
+  n_respa_ = sparams_->n_respa;
+  implicit_bending_ = sparams_->implicit_bending;
+  fused_integrator_ = sparams_->fused_integrator;
+  if (n_respa_ < 1) {
+    Logger::Error("Filament parameter n_respa must be a positive integer");
+  }
   /* Refine parameters */
   if (dynamic_instability_flag_) {
     /* Since dynamic instability requires a bond number that is a power of two,
@@ -203,6 +209,14 @@ void Filament::Reserve() {
   h_mat_lower_.resize(n_sites_max - 2);                 // max_sites-2
   gamma_inverse_.resize(n_sites_max * n_dim_ * n_dim_); // max_sites*ndim*ndim
   cos_thetas_.resize(n_sites_max - 2);                  // max_sites-2
+  respa_forces_.resize(3 * n_sites_max);                // 3*max_sites
+  bend_diag_.resize(n_sites_max);                       // max_sites
+  bend_upper_.resize(n_sites_max - 1);                  // max_sites-1
+  bend_upper2_.resize(n_sites_max - 2);                 // max_sites-2
+  bend_disp_.resize(n_sites_max);                       // max_sites
+  fused_u_.resize(3 * n_sites_max);                     // 3*max_sites
+  fused_utan_.resize(3 * n_sites_max);                  // 3*max_sites
+  fused_f_.resize(3 * n_sites_max);                     // 3*max_sites
 }
 
 void Filament::InsertFirstBond() {
@@ -420,6 +434,23 @@ void Filament::UpdatePosition() {
   Montesi, Morse, Pasquali. J Chem Phys 122, 084903 (2005).
 ********************************************************************************/
 void Filament::Integrate() {
+  /* The predictor midstep is cheap and only locates the configuration where
+     the outer forces are evaluated, so only subcycle on full steps */
+  if (n_respa_ > 1 && !params_->on_midstep) {
+    IntegrateMultipleTimestep();
+    return;
+  }
+  /* The fused kernel does not handle rotated bond frames for intrinsic
+     curvature in 2D, which fall back to the reference path */
+  if (fused_integrator_ &&
+      (n_dim_ == 3 || (curvature_ == 0 && !flagella_flag_))) {
+    IntegrateFused();
+    UpdateBondPositions();
+    if (sparams_->reference_frame_flag) {
+      RotateToReferenceFrame();
+    }
+    return;
+  }
   CalculateAngles();
   CalculateTangents();
   if (params_->on_midstep || no_midstep_) {
@@ -430,7 +461,7 @@ void Filament::Integrate() {
   AddRandomForces();
   CalculateBendingForces();
   CalculateTensions();
-  UpdateSitePositions();
+  UpdateSitePositions(params_->on_midstep ? 0.5 * delta_ : delta_);
   UpdateBondPositions();
   if (sparams_->reference_frame_flag) {
     /* Rotate/translate filament into COM reference frame coordinates */
@@ -438,6 +469,57 @@ void Filament::Integrate() {
   }
 }
 
+/* Multiple time step (RESPA) integration. The forces applied to the sites in
+   ApplyForcesTorques (interactions, crosslinks, traps and driving) vary slowly
+   compared to the bending and tension modes of the filament, so they are held
+   fixed while the intra-filament dynamics are subcycled n_respa times with a
+   step of delta/n_respa. When using the midstep scheme, the outer forces were
+   evaluated at the midstep configuration, and the substeps restart from the
+   positions at the beginning of the outer step. */
+void Filament::IntegrateMultipleTimestep() {
+  for (int i_site = 0; i_site < n_sites_; ++i_site) {
+    double const *const f = sites_[i_site].GetForce();
+    std::copy(f, f + 3, respa_forces_.begin() + 3 * i_site);
+  }
+  if (!no_midstep_) {
+    for (auto site = sites_.begin(); site != sites_.end(); ++site) {
+      site->SetPosition(site->GetPrevPosition());
+    }
+    UpdateBondPositions();
+  }
+  double const dt = delta_ / n_respa_;
+  /* Random forces have variance inversely proportional to the step size */
+  double const sigma_perp = rand_sigma_perp_;
+  double const sigma_par = rand_sigma_par_;
+  rand_sigma_perp_ *= sqrt(n_respa_);
+  rand_sigma_par_ *= sqrt(n_respa_);
+  int n_stages = (no_midstep_ ? 1 : 2);
+  for (int i_sub = 0; i_sub < n_respa_; ++i_sub) {
+    for (int i_stage = 0; i_stage < n_stages; ++i_stage) {
+      CalculateAngles();
+      CalculateTangents();
+      if (i_stage == 0) {
+        ConstructUnprojectedRandomForces();
+        GeometricallyProjectRandomForces();
+        UpdatePrevPositions();
+      }
+      for (int i_site = 0; i_site < n_sites_; ++i_site) {
+        sites_[i_site].SetForce(&respa_forces_[3 * i_site]);
+      }
+      AddRandomForces();
+      CalculateBendingForces();
+      CalculateTensions();
+      UpdateSitePositions(i_stage == n_stages - 1 ? dt : 0.5 * dt);
+      UpdateBondPositions();
+    }
+  }
+  rand_sigma_perp_ = sigma_perp;
+  rand_sigma_par_ = sigma_par;
+  if (sparams_->reference_frame_flag) {
+    RotateToReferenceFrame();
+  }
+}
+
 void Filament::CalculateAngles() {
   for (int i_site = 0; i_site < n_sites_ - 2; ++i_site) {
     double const *const u1 = sites_[i_site].GetOrientation();
@@ -846,8 +928,7 @@ void Filament::CalculateTensions() {
                      n_sites_ - 1);
 }
 
-void Filament::UpdateSitePositions() {
-  double delta = (params_->on_midstep ? 0.5 * delta_ : delta_ );
+void Filament::UpdateSitePositions(double delta) {
   double f_site[3];
   // First get total forces
   // Handle end sites first
@@ -885,7 +966,16 @@ void Filament::UpdateSitePositions() {
     sites_[i_site].SetPosition(r_new);
     site_index += next_site;
   }
-  // Next, update orientation vectors
+  if (implicit_bending_) {
+    ImplicitBendingCorrection(delta);
+  }
+  RenormalizeSites();
+}
+
+/* Update site orientation vectors from the new site positions, then make sure
+   the sites are still bond-length apart */
+void Filament::RenormalizeSites() {
+  // Update orientation vectors
   double u_mag, r_diff[3];
   for (int i_site = 0; i_site < n_sites_ - 1; ++i_site) {
     double const *const r_site1 = sites_[i_site].GetPosition();
@@ -940,6 +1030,255 @@ void Filament::GetErrorRates(std::vector<int> &rates) {
   error_rates_.clear();
 }
 
+/* Semi-implicit treatment of the bending forces. For small angles, the
+   bending energy is k/(2 b^3) |D r|^2, where D is the second difference
+   operator along the filament, giving a stiff linear force -k/b^3 D^T D r
+   whose explicit stability limit scales as b^4. The explicit displacement
+   dr = r - r_prev is filtered through (I + delta k/(gamma_perp b^3) D^T D),
+   which leaves the fixed points unchanged, is first order consistent, and
+   damps the short wavelength bending modes so that the stable timestep is
+   set by the friction rather than the bond length. The tension constraints
+   are enforced as before through the explicit step and renormalization. */
+void Filament::ImplicitBendingCorrection(double delta) {
+  if (n_sites_ < 3 || bending_stiffness_ <= 0) {
+    return;
+  }
+  double c = delta * bending_stiffness_ /
+             (friction_perp_ * bond_length_ * SQR(bond_length_));
+  std::fill(bend_diag_.begin(), bend_diag_.begin() + n_sites_, 1.0);
+  std::fill(bend_upper_.begin(), bend_upper_.begin() + n_sites_ - 1, 0.0);
+  std::fill(bend_upper2_.begin(), bend_upper2_.begin() + n_sites_ - 2, 0.0);
+  // Each row of D has stencil (1, -2, 1) acting on sites i, i+1, i+2
+  for (int i = 0; i < n_sites_ - 2; ++i) {
+    bend_diag_[i] += c;
+    bend_diag_[i + 1] += 4 * c;
+    bend_diag_[i + 2] += c;
+    bend_upper_[i] -= 2 * c;
+    bend_upper_[i + 1] -= 2 * c;
+    bend_upper2_[i] += c;
+  }
+  pentadiagonal_factorize(&bend_diag_, &bend_upper_, &bend_upper2_, n_sites_);
+  double r_new[3];
+  for (int i = 0; i < n_dim_; ++i) {
+    for (int i_site = 0; i_site < n_sites_; ++i_site) {
+      bend_disp_[i_site] = sites_[i_site].GetPosition()[i] -
+                           sites_[i_site].GetPrevPosition()[i];
+    }
+    pentadiagonal_solve(&bend_diag_, &bend_upper_, &bend_upper2_, &bend_disp_,
+                        n_sites_);
+    for (int i_site = 0; i_site < n_sites_; ++i_site) {
+      double const *const r = sites_[i_site].GetPosition();
+      std::copy(r, r + 3, r_new);
+      r_new[i] = sites_[i_site].GetPrevPosition()[i] + bend_disp_[i_site];
+      sites_[i_site].SetPosition(r_new);
+    }
+  }
+}
+
+/* Single-pass version of the Integrate step that gives the same result as the
+   reference path of CalculateAngles, CalculateTangents, random force
+   construction and projection, CalculateBendingForces, CalculateTensions and
+   UpdateSitePositions. Bond orientations, tangents and forces are gathered
+   into contiguous buffers on the first pass, bending forces are written in
+   terms of the cached bond angle cosines, and friction tensors are applied
+   directly rather than being stored as matrices. Random forces are only
+   regenerated when the reference path would regenerate them, and skipped
+   entirely at zero temperature. */
+void Filament::IntegrateFused() {
+  bool const thermal = !zero_temperature_;
+  bool const new_random = thermal && (params_->on_midstep || no_midstep_);
+  double const delta = (params_->on_midstep ? 0.5 * delta_ : delta_);
+  double const inv_perp = 1.0 / friction_perp_;
+  double const inv_diff = 1.0 / friction_par_ - inv_perp;
+  int const n = n_sites_;
+  double *const u = &fused_u_[0];
+  double *const utan = &fused_utan_[0];
+  double *const f = &fused_f_[0];
+  if (params_->on_midstep || no_midstep_) {
+    UpdatePrevPositions();
+  }
+  // Pass 1: gather orientations, tangents, cosines and the forward metric
+  // determinants, and construct unprojected random forces
+  det_t_mat_[0] = 1;
+  det_t_mat_[1] = 2;
+  for (int i_site = 0; i_site < n; ++i_site) {
+    double *const u_i = u + 3 * i_site;
+    double *const t_i = utan + 3 * i_site;
+    double const *const u_site = sites_[i_site].GetOrientation();
+    std::copy(u_site, u_site + 3, u_i);
+    if (i_site == 0) {
+      std::copy(u_i, u_i + 3, t_i);
+    } else if (i_site == n - 1) {
+      std::copy(u_i - 3, u_i, t_i);
+    } else {
+      double t_mag = 0;
+      for (int i = 0; i < 3; ++i) {
+        t_i[i] = u_i[i - 3] + u_i[i];
+        t_mag += SQR(t_i[i]);
+      }
+      t_mag = 1.0 / sqrt(t_mag);
+      for (int i = 0; i < 3; ++i) {
+        t_i[i] *= t_mag;
+      }
+      cos_thetas_[i_site - 1] = dot_product(n_dim_, u_i - 3, u_i);
+      if (i_site > 1) {
+        det_t_mat_[i_site] = 2 * det_t_mat_[i_site - 1] -
+                             SQR(cos_thetas_[i_site - 2]) *
+                                 det_t_mat_[i_site - 2];
+      }
+    }
+    sites_[i_site].SetTangent(t_i);
+    double *const f_i = f + 3 * i_site;
+    if (new_random) {
+      double xi[3] = {0, 0, 0};
+      for (int i = 0; i < n_dim_; ++i)
+        xi[i] = rng_.RandomUniform() - 0.5;
+      double const t_dot_xi = dot_product(n_dim_, t_i, xi);
+      for (int i = 0; i < n_dim_; ++i) {
+        f_i[i] = rand_sigma_perp_ * xi[i] +
+                 (rand_sigma_par_ - rand_sigma_perp_) * t_i[i] * t_dot_xi;
+      }
+    }
+  }
+  if (n > 2) {
+    det_t_mat_[n - 1] = 2 * det_t_mat_[n - 2] -
+                        SQR(cos_thetas_[n - 3]) * det_t_mat_[n - 3];
+  }
+  if (spiral_init_flag_) {
+    CalculateSpiralNumber();
+  }
+  // Project random forces onto the constraint manifold
+  if (new_random) {
+    for (int i_site = 0; i_site < n - 1; ++i_site) {
+      double const *const u_i = u + 3 * i_site;
+      double const *const f_i = f + 3 * i_site;
+      tensions_[i_site] = 0;
+      for (int i = 0; i < n_dim_; ++i)
+        tensions_[i_site] += (f_i[i + 3] - f_i[i]) * u_i[i];
+      g_mat_diag_[i_site] = 2;
+      if (i_site > 0) {
+        g_mat_upper_[i_site - 1] = -cos_thetas_[i_site - 1];
+        g_mat_lower_[i_site - 1] = -cos_thetas_[i_site - 1];
+      }
+    }
+    tridiagonal_solver(&g_mat_lower_, &g_mat_diag_, &g_mat_upper_, &tensions_,
+                       n - 1);
+  }
+  // Backward metric determinants
+  det_b_mat_[n] = 1;
+  det_b_mat_[n - 1] = 2;
+  for (int i = 2; i < n; ++i) {
+    det_b_mat_[n - i] = 2 * det_b_mat_[n - i + 1] -
+                        SQR(cos_thetas_[n - i - 1]) * det_b_mat_[n - i + 2];
+  }
+  double const det_g_inv = 1.0 / det_t_mat_[n - 1];
+  double const b_inv2 = 1.0 / SQR(bond_length_);
+  for (int i = 0; i < n - 2; ++i) {
+    g_mat_inverse_[i] =
+        cos_thetas_[i] * det_t_mat_[i] * det_b_mat_[i + 3] * det_g_inv;
+    k_eff_[i] = (bending_stiffness_ + bond_length_ * g_mat_inverse_[i]) * b_inv2;
+  }
+  // Pass 2: total non-constraint site forces, mobility-weighted forces and
+  // assembly of the tension equations
+  double gf_prev[3] = {0, 0, 0};
+  for (int i_site = 0; i_site < n; ++i_site) {
+    double const *const u_i = u + 3 * i_site;
+    double const *const t_i = utan + 3 * i_site;
+    double *const f_i = f + 3 * i_site;
+    double f_rand[3] = {0, 0, 0};
+    if (new_random) {
+      // Projected random force
+      for (int i = 0; i < n_dim_; ++i) {
+        f_rand[i] = f_i[i];
+        if (i_site < n - 1)
+          f_rand[i] += tensions_[i_site] * u_i[i];
+        if (i_site > 0)
+          f_rand[i] -= tensions_[i_site - 1] * u_i[i - 3];
+      }
+      sites_[i_site].SetRandomForce(f_rand);
+    } else if (thermal) {
+      double const *const f_r = sites_[i_site].GetRandomForce();
+      std::copy(f_r, f_r + 3, f_rand);
+    }
+    double const *const f_ext = sites_[i_site].GetForce();
+    for (int i = 0; i < n_dim_; ++i) {
+      f_i[i] = f_ext[i] + f_rand[i];
+    }
+    // Bending forces, P(a, b) = a - (a.b) b
+    if (i_site > 1) {
+      double const k = k_eff_[i_site - 2];
+      double const c = cos_thetas_[i_site - 2];
+      for (int i = 0; i < n_dim_; ++i)
+        f_i[i] += k * (u_i[i - 6] - c * u_i[i - 3]);
+    }
+    if (i_site > 0 && i_site < n - 1) {
+      double const k = k_eff_[i_site - 1];
+      double const c = cos_thetas_[i_site - 1];
+      for (int i = 0; i < n_dim_; ++i)
+        f_i[i] += k * ((u_i[i] - c * u_i[i - 3]) - (u_i[i - 3] - c * u_i[i]));
+    }
+    if (i_site < n - 2) {
+      double const k = k_eff_[i_site];
+      double const c = cos_thetas_[i_site];
+      for (int i = 0; i < n_dim_; ++i)
+        f_i[i] -= k * (u_i[i + 3] - c * u_i[i]);
+    }
+    // Mobility-weighted force
+    double gf[3] = {0, 0, 0};
+    double const t_dot_f = dot_product(n_dim_, t_i, f_i);
+    for (int i = 0; i < n_dim_; ++i)
+      gf[i] = inv_perp * f_i[i] + inv_diff * t_i[i] * t_dot_f;
+    if (i_site > 0) {
+      // Tension equation for the bond between i_site-1 and i_site
+      int const i_bond = i_site - 1;
+      double const *const u_b = u_i - 3;
+      double const *const t_b = t_i - 3;
+      tensions_[i_bond] = 0;
+      for (int i = 0; i < n_dim_; ++i)
+        tensions_[i_bond] += u_b[i] * (gf[i] - gf_prev[i]);
+      h_mat_diag_[i_bond] =
+          2.0 * inv_perp +
+          inv_diff * (SQR(dot_product(n_dim_, t_b, u_b)) +
+                      SQR(dot_product(n_dim_, t_i, u_b)));
+      if (i_bond > 0) {
+        h_mat_upper_[i_bond - 1] =
+            -inv_perp * cos_thetas_[i_bond - 1] -
+            inv_diff * dot_product(n_dim_, t_b, u_b - 3) *
+                dot_product(n_dim_, t_b, u_b);
+        h_mat_lower_[i_bond - 1] = h_mat_upper_[i_bond - 1];
+      }
+    }
+    std::copy(gf, gf + 3, gf_prev);
+  }
+  tridiagonal_solver(&h_mat_lower_, &h_mat_diag_, &h_mat_upper_, &tensions_,
+                     n - 1);
+  // Pass 3: add tensions and update positions
+  for (int i_site = 0; i_site < n; ++i_site) {
+    double const *const u_i = u + 3 * i_site;
+    double const *const t_i = utan + 3 * i_site;
+    double *const f_i = f + 3 * i_site;
+    for (int i = 0; i < n_dim_; ++i) {
+      if (i_site < n - 1)
+        f_i[i] += tensions_[i_site] * u_i[i];
+      if (i_site > 0)
+        f_i[i] -= tensions_[i_site - 1] * u_i[i - 3];
+    }
+    sites_[i_site].SetForce(f_i);
+    double const t_dot_f = dot_product(n_dim_, t_i, f_i);
+    double const *const r_prev = sites_[i_site].GetPrevPosition();
+    double r_new[3] = {0, 0, 0};
+    for (int i = 0; i < n_dim_; ++i) {
+      r_new[i] =
+          r_prev[i] + delta * (inv_perp * f_i[i] + inv_diff * t_i[i] * t_dot_f);
+    }
+    sites_[i_site].SetPosition(r_new);
+  }
+  if (implicit_bending_) {
+    ImplicitBendingCorrection(delta);
+  }
+  RenormalizeSites();
+}
+
 bool Filament::CheckBondLengths() {
   bool renormalize = false;
   for (int i_site = 1; i_site < n_sites_; ++i_site) {
@@ -1440,7 +1779,7 @@ void Filament::ReportAll() {
    double curvature (half the intrinsic curvature)
    uchar polymerization_state
     */
-void Filament::WriteSpec(std::fstream &ospec) {
+void Filament::WriteSpec(FrameBuffer &ospec) {
   Logger::Trace("Writing filament specs, object id: %d", GetOID());
   Mesh::WriteSpec(ospec);
   ospec.write(reinterpret_cast<char *>(&bending_stiffness_), sizeof(double));
@@ -1448,7 +1787,7 @@ void Filament::WriteSpec(std::fstream &ospec) {
   ospec.write(reinterpret_cast<char *>(&poly_), sizeof(unsigned char));
 }
 
-void Filament::ConvertSpec(std::fstream &ispec, std::fstream &otext) {
+void Filament::ConvertSpec(FrameReader &ispec, std::fstream &otext) {
   double bending_stiffness, curvature;
   poly_state poly;
   if (ispec.eof())
@@ -1462,7 +1801,21 @@ void Filament::ConvertSpec(std::fstream &ispec, std::fstream &otext) {
   otext << bending_stiffness << " " << curvature << " " << poly._to_string() << std::endl;
 }
 
-void Filament::ReadSpec(std::fstream &ispec) {
+void Filament::ExportSpec(FrameReader &ispec, ColumnFrame &columns) {
+  double bending_stiffness, curvature;
+  unsigned char poly;
+  if (ispec.eof())
+    return;
+  Mesh::ExportSpec(ispec, columns);
+  ispec.read(reinterpret_cast<char *>(&bending_stiffness), sizeof(double));
+  ispec.read(reinterpret_cast<char *>(&curvature), sizeof(double));
+  ispec.read(reinterpret_cast<char *>(&poly), sizeof(unsigned char));
+  columns.Add("bending_stiffness", &bending_stiffness);
+  columns.Add("curvature", &curvature);
+  columns.Add("poly", &poly);
+}
+
+void Filament::ReadSpec(FrameReader &ispec) {
   if (ispec.eof())
     return;
   Mesh::ReadSpec(ispec);
@@ -1482,20 +1835,22 @@ void Filament::ReadSpec(std::fstream &ispec) {
    double diameter
    double length
 */
-void Filament::WritePosit(std::fstream &oposit) {
+void Filament::WritePosit(FrameBuffer &oposit) {
   double avg_pos[3], avg_u[3];
   GetAvgPosition(avg_pos);
   GetAvgOrientation(avg_u);
   std::copy(avg_pos, avg_pos + 3, position_);
   UpdatePeriodic();
   for (auto &pos : position_)
-    oposit.write(reinterpret_cast<char *>(&pos), sizeof(pos));
+    oposit.write(reinterpret_cast<char *>(&pos), sizeof(pos), field_length);
   for (auto &spos : scaled_position_)
-    oposit.write(reinterpret_cast<char *>(&spos), sizeof(spos));
+    oposit.write(reinterpret_cast<char *>(&spos), sizeof(spos), field_unit);
   for (auto &u : avg_u)
-    oposit.write(reinterpret_cast<char *>(&u), sizeof(u));
-  oposit.write(reinterpret_cast<char *>(&diameter_), sizeof(diameter_));
-  oposit.write(reinterpret_cast<char *>(&length_), sizeof(length_));
+    oposit.write(reinterpret_cast<char *>(&u), sizeof(u), field_unit);
+  oposit.write(reinterpret_cast<char *>(&diameter_), sizeof(diameter_),
+               field_length);
+  oposit.write(reinterpret_cast<char *>(&length_), sizeof(length_),
+               field_length);
 }
 
 /* double[3] avg_pos
@@ -1504,7 +1859,7 @@ void Filament::WritePosit(std::fstream &oposit) {
    double diameter
    double length
 */
-void Filament::ReadPosit(std::fstream &iposit) {
+void Filament::ReadPosit(FrameReader &iposit) {
   if (iposit.eof())
     return;
   posits_only_ = true;
@@ -1543,11 +1898,11 @@ void Filament::ReadPosit(std::fstream &iposit) {
   CalculateAngles();
 }
 
-void Filament::WriteCheckpoint(std::fstream &ocheck) {
+void Filament::WriteCheckpoint(FrameBuffer &ocheck) {
   Mesh::WriteCheckpoint(ocheck);
 }
 
-void Filament::ReadCheckpoint(std::fstream &icheck) {
+void Filament::ReadCheckpoint(FrameReader &icheck) {
   Mesh::ReadCheckpoint(icheck);
 }
 
@@ -134,11 +134,21 @@ void FilamentSpecies::UpdatePositions() {
   int max_threads = omp_get_max_threads();
   filament_chunk_vector chunks;
   chunks.reserve(max_threads);
-  size_t chunk_size = members_.size() / max_threads;
+  /* Filament lengths can vary widely, so balance chunks by number of bonds
+     rather than number of filaments */
+  size_t n_work = 0;
+  for (auto it = members_.begin(); it != members_.end(); ++it) {
+    n_work += it->GetNBonds();
+  }
+  size_t work = 0;
   filament_iterator cur_iter = members_.begin();
   for (int i = 0; i < max_threads - 1; ++i) {
     filament_iterator last_iter = cur_iter;
-    std::advance(cur_iter, chunk_size);
+    size_t target = (i + 1) * n_work / max_threads;
+    while (cur_iter != members_.end() && work < target) {
+      work += cur_iter->GetNBonds();
+      ++cur_iter;
+    }
     chunks.push_back(std::make_pair(last_iter, cur_iter));
   }
   chunks.push_back(std::make_pair(cur_iter, members_.end()));
@@ -0,0 +1,43 @@
+#include "cglass/frame_buffer.hpp"
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+
+/* The temporary file is synced before the rename, so the rename can never
+   expose a file whose contents are still only in the page cache, and the
+   directory is synced after it, so the rename itself survives a crash. */
+bool FrameBuffer::Replace(std::string const &file_name) {
+  std::string tmp_name = file_name + ".tmp";
+  int fd = ::open(tmp_name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    return false;
+  }
+  bool ok = true;
+  size_t written = 0;
+  while (ok && written < size_) {
+    ssize_t n = ::write(fd, &buffer_[written], size_ - written);
+    if (n < 0 && errno != EINTR) {
+      ok = false;
+    } else if (n > 0) {
+      written += n;
+    }
+  }
+  Clear();
+  ok = (fsync(fd) == 0 && ok);
+  ok = (::close(fd) == 0 && ok);
+  /* Do not leave a partial temporary file behind */
+  if (!ok || std::rename(tmp_name.c_str(), file_name.c_str()) != 0) {
+    ::unlink(tmp_name.c_str());
+    return false;
+  }
+  size_t slash = file_name.rfind('/');
+  std::string dir_name =
+      (slash == std::string::npos ? "." : file_name.substr(0, slash + 1));
+  int dir_fd = ::open(dir_name.c_str(), O_RDONLY | O_DIRECTORY);
+  if (dir_fd < 0) {
+    return false;
+  }
+  ok = (fsync(dir_fd) == 0);
+  ::close(dir_fd);
+  return ok;
+}
@@ -0,0 +1,106 @@
+#include "cglass/frame_reader.hpp"
+#include "cglass/trajectory_codec.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+FrameReader::FrameReader() {}
+FrameReader::~FrameReader() { close(); }
+
+/* Map the whole file. The file is left unopened if it does not exist or cannot
+   be mapped. The mode is accepted for compatibility with std::fstream; files
+   are always mapped read-only. */
+void FrameReader::open(std::string const &file_name,
+                       std::ios::openmode /* mode */) {
+  close();
+  int fd = ::open(file_name.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    ::close(fd);
+    return;
+  }
+  size_ = st.st_size;
+  if (size_ > 0) {
+    void *map = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED) {
+      ::close(fd);
+      size_ = 0;
+      return;
+    }
+    /* Frames are mostly read front to back */
+    madvise(map, size_, MADV_SEQUENTIAL);
+    map_ = map;
+    data_ = static_cast<const char *>(map);
+  }
+  /* The mapping stays valid after the descriptor is closed */
+  ::close(fd);
+  pos_ = 0;
+  eof_ = false;
+  open_ = true;
+  if (TrajectoryDecoder::IsCompact(data_, size_)) {
+    decoder_.reset(new TrajectoryDecoder);
+    decoder_->Init(data_);
+    pos_ = decoder_->FirstBlock();
+  }
+}
+
+void FrameReader::open(const char *data, size_t size) {
+  close();
+  data_ = data;
+  size_ = size;
+  open_ = true;
+}
+
+void FrameReader::close() {
+  if (map_) {
+    munmap(map_, size_);
+  }
+  map_ = nullptr;
+  data_ = nullptr;
+  size_ = pos_ = 0;
+  eof_ = false;
+  open_ = false;
+  decoder_.reset();
+  frame_.clear();
+  frame_pos_ = 0;
+}
+
+/* Serve reads from decoded frames, decoding the next frame as needed */
+FrameReader &FrameReader::ReadDecoded(char *data, std::streamsize n) {
+  while (n > 0) {
+    if (frame_pos_ == frame_.size()) {
+      frame_pos_ = 0;
+      if (!decoder_->Decode(data_, size_, pos_, frame_)) {
+        frame_.clear();
+        eof_ = true;
+        break;
+      }
+      continue;
+    }
+    size_t n_read = frame_.size() - frame_pos_;
+    if ((std::streamsize)n_read > n) {
+      n_read = n;
+    }
+    std::memcpy(data, &frame_[frame_pos_], n_read);
+    frame_pos_ += n_read;
+    data += n_read;
+    n -= n_read;
+  }
+  return *this;
+}
+
+void FrameReader::seekg(std::streamoff offset) {
+  if (decoder_) {
+    /* Discard the rest of the current frame */
+    frame_.clear();
+    frame_pos_ = 0;
+    if (!decoder_->Seek(data_, size_, offset)) {
+      offset = size_;
+    }
+  }
+  pos_ = offset;
+}
@@ -135,6 +135,55 @@ void InteractionManager::UpdateInteractors() {
                 ix_objects_.size(), xlinks.size(), interactors_.size());
 }
 
+/* Remove destroyed interactors and insert new ones without rebuilding the
+   cell list or the full set of pair interactions. Removed pointers are only
+   compared, never dereferenced. */
+void InteractionManager::UpdateInteractorsIncremental(
+    std::vector<Object *> const &added, std::vector<Object *> const &removed) {
+  Logger::Trace("Incrementally updating interactors: %lu added, %lu removed",
+                added.size(), removed.size());
+  auto is_removed = [&removed](Object *obj) {
+    return std::find(removed.begin(), removed.end(), obj) != removed.end();
+  };
+  if (!removed.empty()) {
+    ix_objects_.erase(
+        std::remove_if(ix_objects_.begin(), ix_objects_.end(), is_removed),
+        ix_objects_.end());
+    interactors_.erase(
+        std::remove_if(interactors_.begin(), interactors_.end(), is_removed),
+        interactors_.end());
+    pair_interactions_.erase(
+        std::remove_if(pair_interactions_.begin(), pair_interactions_.end(),
+                       [&is_removed](Interaction const &ix) {
+                         return is_removed(ix.obj1) || is_removed(ix.obj2);
+                       }),
+        pair_interactions_.end());
+    boundary_interactions_.erase(
+        std::remove_if(boundary_interactions_.begin(),
+                       boundary_interactions_.end(),
+                       [&is_removed](Interaction const &ix) {
+                         return is_removed(ix.obj1);
+                       }),
+        boundary_interactions_.end());
+    if (!no_interactions_) {
+      clist_.RemoveObjects(removed);
+    }
+  }
+  for (auto obj = added.begin(); obj != added.end(); ++obj) {
+    ix_objects_.push_back(*obj);
+    interactors_.push_back(*obj);
+    if (!no_interactions_) {
+      clist_.AddObject(**obj, pair_interactions_);
+    }
+    if (!no_boundaries_) {
+      Interaction ix(*obj);
+      if (mindist_.CheckBoundaryInteraction(ix)) {
+        boundary_interactions_.push_back(ix);
+      }
+    }
+  }
+}
+
 /* Checks whether or not the given anchor is supposed to be attached to the
    given bond by checking comp_id of both the bond and the anchor. If they
    match, the anchor is attached to the mesh using the anchor mesh_lambda */
@@ -301,11 +350,35 @@ void InteractionManager::CheckUpdateObjects() {
      never change, so we don't bother counting particles and move on */
   if (processing_)
     return;
+  /* Binding totals follow object sizes, which may change on every step */
+  for (auto spec = species_->begin(); spec != species_->end(); ++spec) {
+    if ((*spec)->CheckInteractorSizeUpdate()) {
+      xlink_.FlagObjsSizeUpdate();
+      break;
+    }
+  }
   if (static_pnumber_)
     return;
   bool ix_update = CheckSpeciesInteractorUpdate();
   int obj_count = CountSpecies();
-  if (obj_count != n_objs_ || ix_update) {
+  /* Objects that were only added or removed (e.g. bonds of growing and
+     shrinking filaments) are updated incrementally when the reported changes
+     account for the change in the object count */
+  std::vector<Object *> added, removed;
+  for (auto spec = species_->begin(); spec != species_->end(); ++spec) {
+    (*spec)->GetInteractorUpdates(added, removed);
+  }
+  if (!ix_update && n_objs_ >= 0 &&
+      obj_count == n_objs_ + (int)added.size() - (int)removed.size()) {
+    if (!added.empty() || !removed.empty()) {
+      n_objs_ = obj_count;
+      UpdateInteractorsIncremental(added, removed);
+      xlink_.UpdateObjsSize();
+    }
+    return;
+  }
+  if (obj_count != n_objs_ || ix_update || !added.empty() ||
+      !removed.empty()) {
     // reset update count and update number of objects to track
     n_objs_ = obj_count;
     Logger::Debug("Updating interactions due to object update. %d steps since"
@@ -426,12 +499,10 @@ void InteractionManager::ProcessPairInteraction(ix_iterator ix) {
     }
   }
 
-  /* If one object is a crosslink, add object to crosslink neighbor list */
-  if (obj1->GetSID() == +species_id::crosslink) {
-    xlink_.AddNeighborToAnchor(obj1, obj2);
-    return;
-  } else if (obj2->GetSID() == +species_id::crosslink) {
-    xlink_.AddNeighborToAnchor(obj2, obj1);
+  /* If one object is a crosslink, the pair is only used to build the
+     crosslink neighbor lists after all pairs are processed */
+  if (obj1->GetSID() == +species_id::crosslink ||
+      obj2->GetSID() == +species_id::crosslink) {
     return;
   }
   mindist_.ObjectObject(*ix);
@@ -576,6 +647,9 @@ void InteractionManager::CalculatePairInteractions() {
     ix->obj2->GiveInteraction(oix2);
   }
 #endif
+  if (!processing_) {
+    xlink_.BuildAnchorNeighbors(pair_interactions_);
+  }
   /* After interaction update, remove pairs of interactors who can never
    * interact */
   if (i_update_ == 0) {
@@ -784,6 +858,7 @@ void InteractionManager::InitOutputs(bool reading_inputs,
 void InteractionManager::ReadInputs() { xlink_.ReadInputs(); }
 
 void InteractionManager::Convert() { xlink_.Convert(); }
+void InteractionManager::ExportColumns() { xlink_.ExportColumns(); }
 
 void InteractionManager::InitCrosslinkSpecies(sid_label &slab,
                                               ParamsParser &parser,
@@ -0,0 +1,260 @@
+#include "cglass/job_runner.hpp"
+#include "cglass/parameters.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <glob.h>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <yaml-cpp/yaml.h>
+#ifdef ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+void JobRunner::Init(std::string exe, std::string batch_name, int n_jobs,
+                     bool debug) {
+  /* Prefer the path of the running executable, since exe is argv[0] and may
+     have been found through PATH */
+  char exe_path[4096];
+  ssize_t len = readlink("/proc/self/exe", exe_path, sizeof(exe_path) - 1);
+  if (len > 0) {
+    exe_path[len] = '\0';
+    exe_ = exe_path;
+  } else {
+    exe_ = exe;
+  }
+  status_file_ = batch_name + ".jobs";
+  n_jobs_ = (n_jobs < 1 ? 1 : n_jobs);
+  debug_ = debug;
+#ifdef ENABLE_OPENMP
+  n_threads_ = omp_get_max_threads() / n_jobs_;
+  if (n_threads_ < 1) {
+    n_threads_ = 1;
+  }
+#endif
+  LoadStatus();
+}
+
+/* The status file lists the parameter files of completed runs, one per line */
+void JobRunner::LoadStatus() {
+  std::ifstream status(status_file_);
+  std::string param_file;
+  while (std::getline(status, param_file)) {
+    if (!param_file.empty()) {
+      completed_.insert(param_file);
+    }
+  }
+}
+
+void JobRunner::RecordCompleted(std::string const &param_file) {
+  completed_.insert(param_file);
+  std::ofstream status(status_file_, std::ios::out | std::ios::app);
+  if (!status.is_open()) {
+    Logger::Warning("Unable to record completed run in %s",
+                    status_file_.c_str());
+    return;
+  }
+  status << param_file << "\n";
+}
+
+std::string JobRunner::GetRunName(std::string const &param_file) const {
+  std::string suffix = "_params.yaml";
+  if (param_file.size() > suffix.size() &&
+      param_file.compare(param_file.size() - suffix.size(), suffix.size(),
+                         suffix) == 0) {
+    return param_file.substr(0, param_file.size() - suffix.size());
+  }
+  return param_file;
+}
+
+/* Name of the run that reloads run_name from its checkpoints, following the
+   naming used by SimulationManager::WriteParams */
+std::string JobRunner::GetReloadName(std::string const &run_name) const {
+  size_t pos = run_name.rfind("_reload");
+  if (pos == std::string::npos || run_name.size() < 3) {
+    return run_name + "_reload001";
+  }
+  int n_load = atoi(run_name.substr(run_name.size() - 3).c_str());
+  std::ostringstream nload;
+  nload << std::setw(3) << std::setfill('0') << n_load + 1;
+  return run_name.substr(0, run_name.size() - 3) + nload.str();
+}
+
+/* Check for checkpoint files written by run_name itself, as opposed to its
+   reloads, which share the run name as a prefix */
+bool JobRunner::HasCheckpoint(std::string const &run_name) const {
+  std::string prefix = run_name + "_";
+  glob_t matches;
+  bool found = false;
+  if (glob((prefix + "*.checkpoint").c_str(), 0, nullptr, &matches) == 0) {
+    for (size_t i = 0; i < matches.gl_pathc && !found; ++i) {
+      std::string file_name(matches.gl_pathv[i]);
+      found = (file_name.compare(prefix.size(), 6, "reload") != 0);
+    }
+  }
+  globfree(&matches);
+  return found;
+}
+
+/* Follow the chain of reloads of run_name and return the last one that wrote
+   checkpoints, or an empty string if there are none */
+std::string JobRunner::FindLatestCheckpointRun(
+    std::string const &run_name) const {
+  std::string latest = (HasCheckpoint(run_name) ? run_name : "");
+  std::string reload = run_name;
+  while (true) {
+    reload = GetReloadName(reload);
+    std::ifstream param_file(reload + "_params.yaml");
+    if (!param_file.is_open()) {
+      break;
+    }
+    if (HasCheckpoint(reload)) {
+      latest = reload;
+    }
+  }
+  return latest;
+}
+
+/* Number of steps simulated up to the last checkpoint of run_name, or -1 if
+   it was not recorded */
+int JobRunner::GetCheckpointStep(std::string const &run_name) const {
+  std::ifstream step_file(run_name + ".checkpoint_step");
+  int step = -1;
+  if (!(step_file >> step)) {
+    return -1;
+  }
+  return step;
+}
+
+/* Write the parameters that reload checkpoint_run for the steps of the
+   original run that remain after its last checkpoint, returning the file
+   name */
+std::string JobRunner::WriteResumeParams(job const &j,
+                                         std::string const &checkpoint_run,
+                                         int checkpoint_step) const {
+  YAML::Node node = YAML::LoadFile(checkpoint_run + "_params.yaml");
+  YAML::Node run_node = YAML::LoadFile(j.param_file);
+  int n_steps = (run_node["n_steps"] ? run_node["n_steps"].as<int>()
+                                     : system_parameters().n_steps);
+  int remaining = n_steps - checkpoint_step;
+  node["n_steps"] = (remaining > 0 ? remaining : 0);
+  node["checkpoint_step"] = checkpoint_step;
+  std::string param_file = checkpoint_run + "_resume_params.yaml";
+  std::ofstream pfile(param_file, std::ios_base::out);
+  YAML::Emitter out;
+  pfile << (out << node).c_str();
+  Logger::Info("Resuming run %s at step %d of %d from checkpoints of %s",
+               j.run_name.c_str(), checkpoint_step, n_steps,
+               checkpoint_run.c_str());
+  return param_file;
+}
+
+bool JobRunner::Launch(job &j) {
+  std::string param_file = j.param_file;
+  bool resume = false;
+  std::string checkpoint_run = FindLatestCheckpointRun(j.run_name);
+  if (!checkpoint_run.empty()) {
+    resume = true;
+    int checkpoint_step = GetCheckpointStep(checkpoint_run);
+    if (checkpoint_step >= 0) {
+      param_file = WriteResumeParams(j, checkpoint_run, checkpoint_step);
+    } else {
+      /* Without the step, the run can only be reloaded for another n_steps */
+      param_file = checkpoint_run + "_params.yaml";
+      Logger::Warning("Checkpoints of %s do not record their step, reloading "
+                      "run %s for another n_steps", checkpoint_run.c_str(),
+                      j.run_name.c_str());
+    }
+  } else {
+    Logger::Info("Starting run %s", j.run_name.c_str());
+  }
+  std::vector<std::string> args = {exe_};
+  if (debug_) {
+    args.push_back("--debug");
+  }
+  if (resume) {
+    args.push_back("--load");
+  }
+  args.push_back(param_file);
+  std::vector<char *> argv;
+  for (auto it = args.begin(); it != args.end(); ++it) {
+    argv.push_back(const_cast<char *>(it->c_str()));
+  }
+  argv.push_back(nullptr);
+  /* Don't let the child inherit unwritten output */
+  fflush(nullptr);
+  j.pid = fork();
+  if (j.pid < 0) {
+    Logger::Warning("Unable to start process for run %s", j.run_name.c_str());
+    return false;
+  }
+  if (j.pid == 0) {
+    if (n_threads_ > 0) {
+      setenv("OMP_NUM_THREADS", std::to_string(n_threads_).c_str(), 1);
+    }
+    execv(exe_.c_str(), &argv[0]);
+    perror("execv");
+    _exit(127);
+  }
+  return true;
+}
+
+int JobRunner::Run(std::vector<std::string> const &param_files) {
+  std::vector<job> queue;
+  for (auto it = param_files.begin(); it != param_files.end(); ++it) {
+    if (completed_.count(*it)) {
+      Logger::Info("Skipping run %s, already completed according to %s",
+                   GetRunName(*it).c_str(), status_file_.c_str());
+      continue;
+    }
+    job j;
+    j.param_file = *it;
+    j.run_name = GetRunName(*it);
+    queue.push_back(j);
+  }
+  if (n_threads_ > 0) {
+    Logger::Info("Running %d simulations, %d at a time on %d threads each",
+                 (int)queue.size(), n_jobs_, n_threads_);
+  } else {
+    Logger::Info("Running %d simulations, %d at a time", (int)queue.size(),
+                 n_jobs_);
+  }
+  std::map<pid_t, job> running;
+  int n_failed = 0;
+  auto next = queue.begin();
+  while (next != queue.end() || !running.empty()) {
+    while (next != queue.end() && (int)running.size() < n_jobs_) {
+      if (Launch(*next)) {
+        running[next->pid] = *next;
+      } else {
+        n_failed++;
+      }
+      ++next;
+    }
+    if (running.empty()) {
+      continue;
+    }
+    int status = 0;
+    pid_t pid = waitpid(-1, &status, 0);
+    if (pid < 0) {
+      Logger::Error("Lost track of running simulations");
+    }
+    auto finished = running.find(pid);
+    if (finished == running.end()) {
+      continue;
+    }
+    if (WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+      Logger::Info("Run %s completed", finished->second.run_name.c_str());
+      RecordCompleted(finished->second.param_file);
+    } else {
+      Logger::Warning("Run %s did not complete; rerun the batch to resume it",
+                      finished->second.run_name.c_str());
+      n_failed++;
+    }
+    running.erase(finished);
+  }
+  return n_failed;
+}
@@ -196,6 +196,72 @@ void tridiagonal_solver(std::vector<double> *a, std::vector<double> *b,
   return;
 }
 
+void pentadiagonal_factorize(std::vector<double> *d, std::vector<double> *c,
+                             std::vector<double> *e, int n) {
+  //  Computes the LDL^T factorization of the symmetric pentadiagonal
+  //  matrix
+  //
+  //  | d[0] c[0] e[0]   0  |
+  //  | c[0] d[1] c[1] e[1] |
+  //  | e[0] c[1] d[2] c[2] |
+  //  |   0  e[1] c[2] d[3] |
+  //
+  //  No pivoting is done, so the matrix must be positive definite.
+  //
+  //  Input: pointer to array of diagonal elements (*d)
+  //         pointer to array of first off-diagonal elements (*c)
+  //         pointer to array of second off-diagonal elements (*e)
+  //         number of unknowns (n)
+  //
+  //  Output: diagonal of D (*d) and the first and second sub-diagonals of
+  //          the unit lower triangular matrix L (*c, *e)
+
+  for (int i = 0; i < n; ++i) {
+    if (i > 0) {
+      (*d)[i] -= SQR((*c)[i - 1]) * (*d)[i - 1];
+    }
+    if (i > 1) {
+      (*d)[i] -= SQR((*e)[i - 2]) * (*d)[i - 2];
+    }
+    if (i < n - 1) {
+      if (i > 0) {
+        (*c)[i] -= (*c)[i - 1] * (*e)[i - 1] * (*d)[i - 1];
+      }
+      (*c)[i] /= (*d)[i];
+    }
+    if (i < n - 2) {
+      (*e)[i] /= (*d)[i];
+    }
+  }
+}
+
+void pentadiagonal_solve(std::vector<double> const *const d,
+                         std::vector<double> const *const c,
+                         std::vector<double> const *const e,
+                         std::vector<double> *b, int n) {
+  //  Solves Ax=b using the factorization of A computed by
+  //  pentadiagonal_factorize. The factorization may be reused for any
+  //  number of right-hand sides.
+  //
+  //  Output: Array of solutions x (*b)
+
+  for (int i = 1; i < n; ++i) {
+    (*b)[i] -= (*c)[i - 1] * (*b)[i - 1];
+    if (i > 1) {
+      (*b)[i] -= (*e)[i - 2] * (*b)[i - 2];
+    }
+  }
+  for (int i = 0; i < n; ++i) {
+    (*b)[i] /= (*d)[i];
+  }
+  for (int i = n - 2; i >= 0; --i) {
+    (*b)[i] -= (*c)[i] * (*b)[i + 1];
+    if (i < n - 2) {
+      (*b)[i] -= (*e)[i] * (*b)[i + 2];
+    }
+  }
+}
+
 /* This function rotates vector v about vector k by an angle theta.
  * Derived using rodrigues' rotation formula */
 void rotate_vector(double *v, double *k, double theta, int n_dim) {
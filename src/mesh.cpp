@@ -9,6 +9,9 @@ Mesh::Mesh(unsigned long seed) : Composite(seed) {
   comp_type_ = comp_type::mesh;
 }
 
+/* Sites and bonds are drawn from storage reserved for the maximum number of
+   bonds the mesh can have (e.g. set by max_length for dynamic instability), so
+   their addresses remain stable while the mesh grows and shrinks */
 void Mesh::Reserve() {
   sites_.reserve(n_bonds_max_ + 1);
   bonds_.reserve(n_bonds_max_);
@@ -27,6 +30,8 @@ void Mesh::AddSite(Site s) {
   sites_.back().SetColor(color_, draw_);
   sites_.back().SetCompID(GetCompID());
   sites_.back().SetMeshPtr(this);
+  /* Displacements of new sites are measured from where they were created */
+  sites_.back().ZeroDrTot();
   n_sites_++;
   Logger::Trace("Added site number %d, id: %d", n_sites_,
                 sites_.back().GetOID());
@@ -52,6 +57,10 @@ void Mesh::AddBond(Site *site1, Site *site2) {
   } else {
     true_length_ = bonds_.back().GetMeshLambda() + bonds_.back().GetLength();
   }
+  /* Reallocation would invalidate every bond pointer held elsewhere */
+  if (bonds_.size() == bonds_.capacity()) {
+    interactor_update_ = true;
+  }
   Bond b(rng_.GetSeed());
   bonds_.push_back(b);
   bonds_.back().SetColor(color_, draw_);
@@ -67,19 +76,28 @@ void Mesh::AddBond(Site *site1, Site *site2) {
   site2->SetOrientation(bonds_.back().GetOrientation());
 
   true_length_ += bonds_.back().GetLength();
+  bond_oid_index_[bonds_.back().GetOID()] = n_bonds_;
   n_bonds_++;
   Logger::Trace("Added bond number %d, id: %d", n_bonds_,
                 bonds_.back().GetOID());
 
   /* Anytime we change the number of bonds, which are interactors, we signal
-     that interactors must be updated */
-  interactor_update_ = true;
+     that interactors must be updated. Coarse-grained interactors depend on bond
+     index, so they are always fully updated. */
+  if (params_->coarse_grained_mesh_interactions) {
+    interactor_update_ = true;
+  } else {
+    added_interactors_.push_back(&bonds_.back());
+  }
 }
 
 void Mesh::Clear() {
   bonds_.clear();
   sites_.clear();
+  bond_oid_index_.clear();
   n_bonds_ = n_sites_ = 0;
+  added_interactors_.clear();
+  removed_interactors_.clear();
   interactor_update_ = true;
 }
 
@@ -89,11 +107,23 @@ void Mesh::RemoveBondFromTip() {
   sites_.pop_back();
   n_sites_--;
   sites_.back().RemoveBond(bonds_.back().GetOID());
+  Object *bond = &bonds_.back();
+  bond_oid_index_.erase(bonds_.back().GetOID());
   bonds_.pop_back();
   n_bonds_--;
   /* Anytime we change the number of bonds, which are interactors, we signal
      that interactors must be updated */
-  interactor_update_ = true;
+  if (params_->coarse_grained_mesh_interactions) {
+    interactor_update_ = true;
+    return;
+  }
+  auto added = std::find(added_interactors_.begin(), added_interactors_.end(),
+                         bond);
+  if (added != added_interactors_.end()) {
+    added_interactors_.erase(added);
+  } else {
+    removed_interactors_.push_back(bond);
+  }
 }
 
 // Doubles number of bonds in graph while keeping same shape
@@ -399,6 +429,9 @@ void Mesh::ZeroForce() {
 
 void Mesh::UpdateInteractors() {
   interactors_.clear();
+  /* All bonds are gathered, so pending incremental updates are obsolete */
+  added_interactors_.clear();
+  removed_interactors_.clear();
   if (params_->coarse_grained_mesh_interactions) {
     int mc = params_->mesh_coarsening;
     int n = 0;
@@ -424,9 +457,35 @@ void Mesh::GetInteractors(std::vector<Object *> &ix) {
   ix.insert(ix.end(), interactors_.begin(), interactors_.end());
 }
 
+/* Report bonds added or removed since the last call. Pending pointers that
+   do not belong to this mesh's bond storage were inherited by copying another
+   mesh and are discarded, which forces a full update through the object
+   count. */
+void Mesh::GetInteractorUpdates(std::vector<Object *> &added,
+                                std::vector<Object *> &removed) {
+  if (added_interactors_.empty() && removed_interactors_.empty()) {
+    return;
+  }
+  Object *begin = bonds_.data();
+  Object *end = bonds_.data() + bonds_.capacity();
+  std::less<Object *> lt;
+  for (auto it = added_interactors_.begin(); it != added_interactors_.end();
+       ++it) {
+    if (!lt(*it, begin) && lt(*it, end))
+      added.push_back(*it);
+  }
+  for (auto it = removed_interactors_.begin();
+       it != removed_interactors_.end(); ++it) {
+    if (!lt(*it, begin) && lt(*it, end))
+      removed.push_back(*it);
+  }
+  added_interactors_.clear();
+  removed_interactors_.clear();
+}
+
 int Mesh::GetCount() { return n_bonds_; }
 
-void Mesh::ReadPosit(std::fstream &ip) {
+void Mesh::ReadPosit(FrameReader &ip) {
   int size;
   Site s(rng_.GetSeed());
   Bond b(rng_.GetSeed());
@@ -440,7 +499,7 @@ void Mesh::ReadPosit(std::fstream &ip) {
     b.ReadPosit(ip);
 }
 
-void Mesh::WritePosit(std::fstream &op) {
+void Mesh::WritePosit(FrameBuffer &op) {
   int size;
   size = sites_.size();
   op.write(reinterpret_cast<char *>(&size), sizeof(size));
@@ -452,7 +511,7 @@ void Mesh::WritePosit(std::fstream &op) {
     b.WritePosit(op);
 }
 
-void Mesh::ReadSpec(std::fstream &ip) {
+void Mesh::ReadSpec(FrameReader &ip) {
   int nsites = 0;
   ip.read(reinterpret_cast<char *>(&diameter_), sizeof(diameter_));
   ip.read(reinterpret_cast<char *>(&length_), sizeof(length_));
@@ -503,11 +562,13 @@ void Mesh::ReadSpec(std::fstream &ip) {
    int n_sites
    double[3*n_sites] site_positions
    */
-void Mesh::WriteSpec(std::fstream &op) {
+void Mesh::WriteSpec(FrameBuffer &op) {
   Logger::Trace("Writing specs for mesh id %d", GetCompID());
-  op.write(reinterpret_cast<char *>(&diameter_), sizeof(diameter_));
-  op.write(reinterpret_cast<char *>(&length_), sizeof(length_));
-  op.write(reinterpret_cast<char *>(&bond_length_), sizeof(bond_length_));
+  op.write(reinterpret_cast<char *>(&diameter_), sizeof(diameter_),
+           field_length);
+  op.write(reinterpret_cast<char *>(&length_), sizeof(length_), field_length);
+  op.write(reinterpret_cast<char *>(&bond_length_), sizeof(bond_length_),
+           field_length);
   op.write(reinterpret_cast<char *>(&n_sites_), sizeof(int));
   for (auto it = sites_.begin(); it != sites_.end(); ++it) {
     // WriteSpec for sites only writes the site position
@@ -519,7 +580,7 @@ void Mesh::WriteSpecTextHeader(std::fstream &otext) {
   otext << "diameter length bond_length nsites" << std::endl;
 }
 
-void Mesh::ConvertSpec(std::fstream &ispec, std::fstream &otext) {
+void Mesh::ConvertSpec(FrameReader &ispec, std::fstream &otext) {
   double diameter, length, bond_length;
   int nsites;
   if (ispec.eof())
@@ -533,7 +594,30 @@ void Mesh::ConvertSpec(std::fstream &ispec, std::fstream &otext) {
   for (int i = 0; i < nsites; i++) Site::ConvertSpec(ispec, otext);
 }
 
-void Mesh::ReadCheckpoint(std::fstream &ip) {
+/* Site positions go to the site group, indexed by site_offsets */
+void Mesh::ExportSpec(FrameReader &ispec, ColumnFrame &columns) {
+  double diameter, length, bond_length;
+  int nsites;
+  if (ispec.eof())
+    return;
+  ispec.read(reinterpret_cast<char *>(&diameter), sizeof(double));
+  ispec.read(reinterpret_cast<char *>(&length), sizeof(double));
+  ispec.read(reinterpret_cast<char *>(&bond_length), sizeof(double));
+  ispec.read(reinterpret_cast<char *>(&nsites), sizeof(int));
+  if (ispec.eof())
+    return;
+  columns.Add("diameter", &diameter);
+  columns.Add("length", &length);
+  columns.Add("bond_length", &bond_length);
+  columns.AddCount("site", nsites);
+  columns.BeginGroup("site");
+  for (int i = 0; i < nsites && !ispec.eof(); i++) {
+    Site::ExportSpec(ispec, columns);
+  }
+  columns.EndGroup();
+}
+
+void Mesh::ReadCheckpoint(FrameReader &ip) {
   Clear();
   Object::ReadCheckpoint(ip);
   for (auto it = sites_.begin(); it != sites_.end(); ++it) {
@@ -545,7 +629,7 @@ void Mesh::ReadCheckpoint(std::fstream &ip) {
   Logger::Trace("Reloaded mesh from checkpoint with cid %d", GetCompID());
 }
 
-void Mesh::WriteCheckpoint(std::fstream &op) {
+void Mesh::WriteCheckpoint(FrameBuffer &op) {
   Object::WriteCheckpoint(op);
   for (auto it = sites_.begin(); it != sites_.end(); ++it) {
     it->WriteCheckpointHeader(op);
@@ -710,6 +794,8 @@ std::pair<double, double> Mesh::GetAvgOrientationCorrelation() {
   return corr_err;
 }
 
+/* Bond mesh lambdas are the running sum of bond lengths, so the bond holding
+   lambda is found by bisection even when bond lengths are not uniform */
 Bond *Mesh::GetBondAtLambda(double lambda) {
   if (lambda < 0) {
     return GetBond(0);
@@ -717,20 +803,41 @@ Bond *Mesh::GetBondAtLambda(double lambda) {
   if (lambda >= length_) {
     return GetBond(n_bonds_ - 1);
   }
-  return GetBond((int)floor(lambda / bond_length_));
+  auto it = std::upper_bound(
+      bonds_.begin(), bonds_.begin() + n_bonds_, lambda,
+      [](double l, Bond const &b) { return l < b.GetMeshLambda(); });
+  return (it == bonds_.begin() ? GetBond(0) : &(*(it - 1)));
 }
 
-const double Mesh::GetLambdaAtBond(int bond_oid) {
-  double lambda = 0;
-  for (auto it = bonds_.begin(); it != bonds_.end(); ++it) {
-    if (it->GetOID() == bond_oid) {
-      return lambda;
+void Mesh::IndexBondOIDs() {
+  bond_oid_index_.clear();
+  for (int i = 0; i < n_bonds_; ++i) {
+    bond_oid_index_[bonds_[i].GetOID()] = i;
+  }
+}
+
+/* Returns nullptr if the mesh has no bond with the given OID */
+Bond *Mesh::GetBondByOID(int bond_oid) {
+  auto it = bond_oid_index_.find(bond_oid);
+  if (it == bond_oid_index_.end() || it->second >= n_bonds_ ||
+      bonds_[it->second].GetOID() != bond_oid) {
+    IndexBondOIDs();
+    it = bond_oid_index_.find(bond_oid);
+    if (it == bond_oid_index_.end()) {
+      return nullptr;
     }
-    lambda += it->GetLength();
   }
-  Logger::Error("Mesh %d could not find bond with OID %d", GetCompID(),
-                bond_oid);
-  return -1;
+  return &bonds_[it->second];
+}
+
+const double Mesh::GetLambdaAtBond(int bond_oid) {
+  Bond *bond = GetBondByOID(bond_oid);
+  if (!bond) {
+    Logger::Error("Mesh %d could not find bond with OID %d", GetCompID(),
+                  bond_oid);
+    return -1;
+  }
+  return bond->GetMeshLambda();
 }
 
 void Mesh::ZeroOrientationCorrelations() {
@@ -3,6 +3,7 @@
 Object::Object(unsigned long seed) : rng_(seed) {
   // Initialize object ID, guaranteeing thread safety
   InitOID();
+  name_id_ = InternName(name_);
   // Set some defaults
   std::fill(position_, position_ + 3, 0.0);
   std::fill(prev_position_, prev_position_ + 3, 0.0);
@@ -42,6 +43,7 @@ void Object::InitOID() {
 
 int Object::_next_oid_ = 0;
 std::mutex Object::_obj_mtx_;
+std::map<std::string, int> Object::_name_ids_;
 system_parameters *Object::params_ = nullptr;
 SpaceBase *Object::space_ = nullptr;
 int Object::n_dim_ = 0;
@@ -181,6 +183,27 @@ void Object::SetCompPtr(Object* comp) { comp_ptr_ = comp; }
 void Object::SetOID(int oid) { oid_ = oid; }
 void Object::ToggleIsMesh() { is_mesh_ = !is_mesh_; }
 const std::string& Object::GetName() const { return name_; }
+/* Integer ID of the object name, so that per-name lookups done for every
+   object (e.g. binding parameters) can index a vector instead of comparing
+   strings. The ID is interned whenever the name is set, so reading it is safe
+   from parallel regions. */
+const int Object::GetNameID() const { return name_id_; }
+void Object::SetName(std::string const &name) {
+  name_ = name;
+  name_id_ = InternName(name_);
+}
+const int Object::InternName(std::string const &name) {
+  std::lock_guard<std::mutex> lk(_obj_mtx_);
+  auto it = _name_ids_.find(name);
+  if (it == _name_ids_.end()) {
+    it = _name_ids_.insert(std::make_pair(name, (int)_name_ids_.size())).first;
+  }
+  return it->second;
+}
+const int Object::GetNNames() {
+  std::lock_guard<std::mutex> lk(_obj_mtx_);
+  return _name_ids_.size();
+}
 shape const Object::GetShape() { return shape_; }
 obj_type const Object::GetType() { return type_; }
 comp_type const Object::GetCompType() { return comp_type_; }
@@ -279,6 +302,8 @@ int Object::GetCount() { return 1; }
 void Object::GetInteractors(std::vector<Object *> &ix) {
   ix.insert(ix.end(), interactors_.begin(), interactors_.end());
 }
+void Object::GetInteractorUpdates(std::vector<Object *> &added,
+                                  std::vector<Object *> &removed) {}
 void Object::CalcPCPosition(double s, double* pos) {
   for (int j = 0; j < n_dim_; ++j) {
     pos[j] = position_[j] + orientation_[j]*s;
@@ -409,11 +434,11 @@ void Object::ClearInteractions() { ixs_.clear(); }
 void Object::Cleanup() {}
 
 // Object I/O functions
-void Object::WriteCheckpoint(std::fstream &ocheck) {
+void Object::WriteCheckpoint(FrameBuffer &ocheck) {
   WriteCheckpointHeader(ocheck);
   WriteSpec(ocheck);
 }
-void Object::WriteCheckpointHeader(std::fstream &ocheck) {
+void Object::WriteCheckpointHeader(FrameBuffer &ocheck) {
   void *rng_state = rng_.GetState();
   size_t rng_size = rng_.GetSize();
   int oid = GetOID();
@@ -424,12 +449,12 @@ void Object::WriteCheckpointHeader(std::fstream &ocheck) {
   ocheck.write(reinterpret_cast<char *>(rng_state), rng_size);
 }
 
-void Object::ReadCheckpoint(std::fstream &icheck) {
+void Object::ReadCheckpoint(FrameReader &icheck) {
   ReadCheckpointHeader(icheck);
   ReadSpec(icheck);
 }
 
-void Object::ReadCheckpointHeader(std::fstream &icheck) {
+void Object::ReadCheckpointHeader(FrameReader &icheck) {
   if (icheck.eof())
     return;
   void *rng_state = rng_.GetState();
@@ -444,18 +469,21 @@ void Object::ReadCheckpointHeader(std::fstream &icheck) {
   SetCompID(cid);
 }
 
-void Object::WritePosit(std::fstream &oposit) {
+void Object::WritePosit(FrameBuffer &oposit) {
   for (auto &posit : position_)
-    oposit.write(reinterpret_cast<char *>(&posit), sizeof(posit));
+    oposit.write(reinterpret_cast<char *>(&posit), sizeof(posit),
+                 field_length);
   for (auto &spos : scaled_position_)
-    oposit.write(reinterpret_cast<char *>(&spos), sizeof(spos));
+    oposit.write(reinterpret_cast<char *>(&spos), sizeof(spos), field_unit);
   for (auto &u : orientation_)
-    oposit.write(reinterpret_cast<char *>(&u), sizeof(u));
-  oposit.write(reinterpret_cast<char *>(&diameter_), sizeof(diameter_));
-  oposit.write(reinterpret_cast<char *>(&length_), sizeof(length_));
+    oposit.write(reinterpret_cast<char *>(&u), sizeof(u), field_unit);
+  oposit.write(reinterpret_cast<char *>(&diameter_), sizeof(diameter_),
+               field_length);
+  oposit.write(reinterpret_cast<char *>(&length_), sizeof(length_),
+               field_length);
 }
 
-void Object::ReadPosit(std::fstream &iposit) {
+void Object::ReadPosit(FrameReader &iposit) {
   if (iposit.eof())
     return;
   for (auto &posit : position_)
@@ -473,7 +501,7 @@ void Object::WritePositTextHeader(std::fstream &otext) {
         << "orientation[1] orientation[2] diameter length" << std::endl;
 }
 
-void Object::ConvertPosit(std::fstream &iposit, std::fstream &otext) {
+void Object::ConvertPosit(FrameReader &iposit, std::fstream &otext) {
   double position[3], scaled_position[3], orientation[3];
   double diameter, length;
   if (iposit.eof())
@@ -491,15 +519,32 @@ void Object::ConvertPosit(std::fstream &iposit, std::fstream &otext) {
         << scaled_position[2] << " " << orientation[0] << " " << orientation[1] 
         << " " << orientation[2] << " " << diameter << " " << length << std::endl;
 }
-void Object::WriteSpec(std::fstream &ospec) { WritePosit(ospec); }
-void Object::ReadSpec(std::fstream &ispec) { ReadPosit(ispec); }
-void Object::ConvertSpec(std::fstream &ispec, std::fstream &otext) {
+void Object::WriteSpec(FrameBuffer &ospec) { WritePosit(ospec); }
+void Object::ReadSpec(FrameReader &ispec) { ReadPosit(ispec); }
+void Object::ConvertSpec(FrameReader &ispec, std::fstream &otext) {
   ConvertPosit(ispec, otext);
 }
+void Object::ExportSpec(FrameReader &ispec, ColumnFrame &columns) {
+  double position[3], scaled_position[3], orientation[3];
+  double diameter, length;
+  if (ispec.eof())
+    return;
+  ispec.read(reinterpret_cast<char *>(position), sizeof(position));
+  ispec.read(reinterpret_cast<char *>(scaled_position),
+             sizeof(scaled_position));
+  ispec.read(reinterpret_cast<char *>(orientation), sizeof(orientation));
+  ispec.read(reinterpret_cast<char *>(&diameter), sizeof(diameter));
+  ispec.read(reinterpret_cast<char *>(&length), sizeof(length));
+  columns.Add("position", position, 3);
+  columns.Add("scaled_position", scaled_position, 3);
+  columns.Add("orientation", orientation, 3);
+  columns.Add("diameter", &diameter);
+  columns.Add("length", &length);
+}
 void Object::WriteSpecTextHeader(std::fstream &otext) {
   WritePositTextHeader(otext);
 }
-void Object::ReadPositFromSpec(std::fstream &ispec) { ReadPosit(ispec); }
+void Object::ReadPositFromSpec(FrameReader &ispec) { ReadPosit(ispec); }
 void Object::GetAvgPosition(double *ap) {
   std::copy(position_, position_ + 3, ap);
 }
@@ -7,7 +7,7 @@ Receptor::Receptor(unsigned long seed) : Sphere(seed) {
 // Set parameters from sparams struct
 void Receptor::SetParameters() {
   color_ = sparams_->color;
-  name_ = sparams_->name;
+  SetName(sparams_->name);
   draw_ = draw_type::_from_string(sparams_->draw_type.c_str());
   length_ = sparams_->length;
   diameter_ = sparams_->diameter;
@@ -23,7 +23,7 @@ void Receptor::Init(receptor_parameters *sparams) {
 }
 
 // i/o functions- Write/read species file and convert to text
-void Receptor::WriteSpec(std::fstream &ospec) {
+void Receptor::WriteSpec(FrameBuffer &ospec) {
   ospec.write(reinterpret_cast<char*>(&n_anchored_), sizeof(int));
 }
 
@@ -31,14 +31,21 @@ void Receptor::WriteSpecTextHeader(std::fstream &otext) {
   otext << "n_anchored" << std::endl;
 }
 
-void Receptor::ConvertSpec(std::fstream &ispec, std::fstream &otext) {
+void Receptor::ConvertSpec(FrameReader &ispec, std::fstream &otext) {
   if (ispec.eof()) return;
   int n_anchored;
   ispec.read(reinterpret_cast<char*>(&n_anchored), sizeof(int));
   otext << n_anchored << std::endl;
 }
 
-void Receptor::ReadSpec(std::fstream &ispec) {
+void Receptor::ExportSpec(FrameReader &ispec, ColumnFrame &columns) {
+  if (ispec.eof()) return;
+  int n_anchored;
+  ispec.read(reinterpret_cast<char*>(&n_anchored), sizeof(int));
+  columns.Add("n_anchored", &n_anchored);
+}
+
+void Receptor::ReadSpec(FrameReader &ispec) {
   ispec.read(reinterpret_cast<char*>(&n_anchored_), sizeof(int));
 }
 
@@ -8,7 +8,7 @@ RigidFilament::RigidFilament(unsigned long seed) : Mesh(seed) {
 void RigidFilament::SetParameters() {
   /* Read parameters from filament parameters */
   color_ = sparams_->color;
-  name_ = sparams_->name;
+  SetName(sparams_->name);
   draw_ = draw_type::_from_string(sparams_->draw_type.c_str());
   length_ = sparams_->length;
   diameter_ = sparams_->diameter;
@@ -360,12 +360,12 @@ void RigidFilament::ScalePosition() {
 
 void RigidFilament::ReportAll() {}
 
-void RigidFilament::WriteSpec(std::fstream &ospec) {
+void RigidFilament::WriteSpec(FrameBuffer &ospec) {
   Logger::Trace("Writing rigid filament specs, object id: %d", GetOID());
   Mesh::WriteSpec(ospec);
 }
 
-void RigidFilament::ReadSpec(std::fstream &ispec) {
+void RigidFilament::ReadSpec(FrameReader &ispec) {
   if (ispec.eof())
     return;
   Mesh::ReadSpec(ispec);
@@ -377,16 +377,18 @@ void RigidFilament::ReadSpec(std::fstream &ispec) {
    double diameter
    double length
 */
-void RigidFilament::WritePosit(std::fstream &oposit) {
+void RigidFilament::WritePosit(FrameBuffer &oposit) {
   UpdatePeriodic();
   for (auto &pos : position_)
-    oposit.write(reinterpret_cast<char *>(&pos), sizeof(pos));
+    oposit.write(reinterpret_cast<char *>(&pos), sizeof(pos), field_length);
   for (auto &spos : scaled_position_)
-    oposit.write(reinterpret_cast<char *>(&spos), sizeof(spos));
+    oposit.write(reinterpret_cast<char *>(&spos), sizeof(spos), field_unit);
   for (auto &u : orientation_)
-    oposit.write(reinterpret_cast<char *>(&u), sizeof(u));
-  oposit.write(reinterpret_cast<char *>(&diameter_), sizeof(diameter_));
-  oposit.write(reinterpret_cast<char *>(&length_), sizeof(length_));
+    oposit.write(reinterpret_cast<char *>(&u), sizeof(u), field_unit);
+  oposit.write(reinterpret_cast<char *>(&diameter_), sizeof(diameter_),
+               field_length);
+  oposit.write(reinterpret_cast<char *>(&length_), sizeof(length_),
+               field_length);
   auto comp_id = GetCompID();
   oposit.write(reinterpret_cast<char *>(&comp_id), sizeof(comp_id));
 }
@@ -397,7 +399,7 @@ void RigidFilament::WritePosit(std::fstream &oposit) {
    double diameter
    double length
 */
-void RigidFilament::ReadPosit(std::fstream &iposit) {
+void RigidFilament::ReadPosit(FrameReader &iposit) {
   if (iposit.eof())
     return;
   posits_only_ = true;
@@ -415,10 +417,10 @@ void RigidFilament::ReadPosit(std::fstream &iposit) {
   UpdateBondPositions();
 }
 
-void RigidFilament::WriteCheckpoint(std::fstream &ocheck) {
+void RigidFilament::WriteCheckpoint(FrameBuffer &ocheck) {
   Mesh::WriteCheckpoint(ocheck);
 }
 
-void RigidFilament::ReadCheckpoint(std::fstream &icheck) {
+void RigidFilament::ReadCheckpoint(FrameReader &icheck) {
   Mesh::ReadCheckpoint(icheck);
 }
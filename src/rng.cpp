@@ -7,7 +7,9 @@ RNG::RNG(unsigned long seed) {
   gsl_rng_set(rng_, seed);
 }
 
-RNG::~RNG() { gsl_rng_free(rng_); }
+RNG::~RNG() {
+  if (rng_) gsl_rng_free(rng_);
+}
 
 unsigned long RNG::GetSeed() const { return gsl_rng_get(rng_); }
 
@@ -27,6 +29,10 @@ const int RNG::RandomPoisson(const double mean) {
   return gsl_ran_poisson(rng_, mean);
 }
 
+const double RNG::RandomExponential(const double mean) {
+  return gsl_ran_exponential(rng_, mean);
+}
+
 const double RNG::RandomNormal(const double sigma) {
   return gsl_ran_gaussian_ziggurat(rng_, sigma);
 }
@@ -11,6 +11,9 @@ void Simulation::Run(YAML::Node sim_params) {
   InitSimulation();
   // Begin simulation
   RunSimulation();
+  if (params_.insitu_analysis) {
+    FinalizeInsituAnalysis();
+  }
   // Tear down data structures (e.g. cell lists, etc)
   ClearSimulation();
 }
@@ -87,6 +90,10 @@ void Simulation::RunSimulation() {
        accordingly before writing the resulting positions from the Integrate
        step. */
     WriteOutputs();
+    /* Analyze the configuration just written, as post-processing would */
+    if (params_.insitu_analysis) {
+      RunInsituAnalysis();
+    }
     /* Integrate EOM on all objects to update positions, etc */
     Integrate();
     /* Update system pressure, volume, etc if necessary */
@@ -177,6 +184,39 @@ void Simulation::Statistics() {
   }
 }
 
+/* Attach species analyses to the running simulation */
+void Simulation::InitInsituAnalysis() {
+  Logger::Info("Running species analyses in-situ every n_spec steps");
+  for (auto it = species_.begin(); it != species_.end(); ++it) {
+    (*it)->InitInsituAnalysis(params_.async_insitu_analysis);
+  }
+}
+
+/* Run species analyses on the steps their spec frames are written, on the
+ * configuration that was written, once the system has equilibrated. This
+ * matches running the analyses on the spec files afterwards. */
+void Simulation::RunInsituAnalysis() {
+  if (params_.i_step == params_.prev_step ||
+      params_.i_step < inv_step_fact_ * params_.n_steps_equil) {
+    return;
+  }
+  for (auto it = species_.begin(); it != species_.end(); ++it) {
+    if (params_.i_step % (inv_step_fact_ * (*it)->GetNSpec()) == 0) {
+      (*it)->RunInsituAnalysis(params_.i_step);
+    }
+  }
+}
+
+/* Finalize analyses as post-processing would, if any were run */
+void Simulation::FinalizeInsituAnalysis() {
+  if (params_.i_step <= inv_step_fact_ * params_.n_steps_equil) {
+    return;
+  }
+  for (auto it = species_.begin(); it != species_.end(); ++it) {
+    (*it)->FinalizeAnalysis();
+  }
+}
+
 /* Update object positions in periodic space if the system size changed. */
 void Simulation::ScaleSpeciesPositions() {
   for (auto spec : species_) {
@@ -220,6 +260,9 @@ void Simulation::InitSimulation() {
   if (params_.graph_flag) {
     InitGraphics();
   }
+  if (params_.insitu_analysis) {
+    InitInsituAnalysis();
+  }
   params_.i_step = 0;
   WriteOutputs();
 }
@@ -537,7 +580,7 @@ void Simulation::InitInputs(run_options run_opts) {
   output_mgr_.Init(&params_, &species_, space_.GetSpaceBase(), true, &run_opts);
   ix_mgr_.InitOutputs(true, &run_opts);
   /* Initialize object positions from output files if post-processing */
-  if (run_opts.convert) return;
+  if (run_opts.convert || run_opts.columns) return;
   output_mgr_.ReadInputs();
   ix_mgr_.ReadInputs();
 }
@@ -594,6 +637,7 @@ void Simulation::InitProcessing(run_options run_opts) {
   // ix_mgr_.InitInteractions();
   InsertSpecies(true, true);
   InitInputs(run_opts);
+  InitFrameRange(run_opts);
   if (run_opts.analysis_flag) {
     for (auto it = species_.begin(); it != species_.end(); ++it) {
       (*it)->InitAnalysis();
@@ -601,6 +645,7 @@ void Simulation::InitProcessing(run_options run_opts) {
         ix_mgr_.SetInteractionAnalysis(true);
       }
     }
+    InitFrameParallelAnalysis(run_opts);
   }
   ix_mgr_.InitInteractions();
   ix_mgr_.ResetCellList();
@@ -622,12 +667,135 @@ void Simulation::InitProcessing(run_options run_opts) {
   }
 }
 
+/* Choose the steps visited during post-processing. By default every step is
+ * visited and input frames are read sequentially. If a frame range was
+ * requested, or if we are only running analyses that begin after
+ * n_steps_equil, only steps on which frames were written are visited and
+ * inputs are positioned using the frame index files. Frame k is the frame read
+ * on step k times the input frame interval; frame 0 is read on
+ * initialization. Each step processes the frame read on the previous visited
+ * step, so the first frame of the range is read here, ahead of the first
+ * visited step. */
+void Simulation::InitFrameRange(run_options run_opts) {
+  frame_initial_step_ = 0;
+  frame_first_step_ = 1;
+  frame_last_step_ = inv_step_fact_ * params_.n_steps;
+  frame_step_stride_ = 1;
+  int n_frame = output_mgr_.GetInputFrameInterval();
+  int n_ix_frame = ix_mgr_.GetInputFrameInterval();
+  while (n_ix_frame > 0) {
+    int rem = n_frame % n_ix_frame;
+    n_frame = n_ix_frame;
+    n_ix_frame = rem;
+  }
+  bool indexed = (n_frame > 0 && output_mgr_.HasFrameIndex() &&
+                  ix_mgr_.HasFrameIndex());
+  int n_frame_steps = inv_step_fact_ * n_frame;
+  int first_frame = -1;
+  int stop_frame = -1;
+  int frame_stride = 1;
+  if (run_opts.frames_flag) {
+    if (run_opts.convert || run_opts.columns || run_opts.with_reloads) {
+      Logger::Error("Frame ranges cannot be used when converting outputs or "
+                    "reading reloaded outputs");
+    }
+    if (!indexed) {
+      Logger::Error("Frame ranges require frame index files for all inputs");
+    }
+    first_frame = run_opts.frame_start;
+    stop_frame = run_opts.frame_stop;
+    frame_stride = run_opts.frame_stride;
+  } else if (indexed && run_opts.analysis_flag && params_.n_steps_equil > 0 &&
+             !run_opts.graphics_flag && !run_opts.make_movie &&
+             !run_opts.convert && !run_opts.reduce_flag &&
+             !run_opts.with_reloads) {
+    /* Nothing is analyzed before n_steps_equil, so seek straight to the
+       frame processed on the first frame step after it */
+    int equil_frame =
+        (inv_step_fact_ * params_.n_steps_equil + n_frame_steps - 1) /
+        n_frame_steps;
+    first_frame = equil_frame - 1;
+  }
+  if (first_frame < 0) {
+    return;
+  }
+  frame_steps steps = GetFrameSteps(first_frame, stop_frame, frame_stride,
+                                    n_frame_steps, frame_last_step_);
+  frame_initial_step_ = steps.initial_step;
+  frame_first_step_ = steps.first_step;
+  frame_last_step_ = steps.last_step;
+  frame_step_stride_ = steps.step_stride;
+  output_mgr_.SetSeekFrames(true);
+  ix_mgr_.SetSeekFrames(true);
+  Logger::Info("Processing frames from step %d to %d every %d steps",
+               frame_first_step_, frame_last_step_, frame_step_stride_);
+  if (frame_initial_step_ > 0) {
+    params_.i_step = frame_initial_step_;
+    output_mgr_.ReadInputs();
+    ix_mgr_.ReadInputs();
+  }
+}
+
+/* Frame-parallel analysis is used if requested and every species analysis
+ * depends only on the members of a single frame of its own species, which
+ * rules out interaction analyses. Otherwise outputs are processed serially. */
+void Simulation::InitFrameParallelAnalysis(run_options run_opts) {
+  frame_parallel_ = false;
+  if (!params_.frame_parallel_analysis) {
+    return;
+  }
+  if (run_opts.graphics_flag || run_opts.make_movie || run_opts.convert ||
+      run_opts.reduce_flag || run_opts.with_reloads) {
+    Logger::Warning("Frame-parallel analysis is only used for analysis runs");
+    return;
+  }
+  if (ix_mgr_.GetInteractionAnalysis()) {
+    Logger::Warning("Frame-parallel analysis is not available for analyses "
+                    "that require interactions");
+    return;
+  }
+  for (auto it = species_.begin(); it != species_.end(); ++it) {
+    if (!(*it)->CanRunFrameParallelAnalysis(run_opts.use_posits)) {
+      Logger::Warning("Frame-parallel analysis is not available for %s "
+                      "analyses, or their inputs have no frame index",
+                      (*it)->GetSpeciesName().c_str());
+      return;
+    }
+  }
+  frame_parallel_ = true;
+}
+
+/* Run each species' analyses over its frames in parallel, then finalize them
+ * as RunProcessing would */
+void Simulation::RunFrameParallelAnalysis(run_options run_opts) {
+  for (auto it = species_.begin(); it != species_.end(); ++it) {
+    (*it)->RunFrameParallelAnalysis(frame_initial_step_, frame_first_step_,
+                                    frame_last_step_, frame_step_stride_,
+                                    run_opts.use_posits);
+  }
+  if (frame_last_step_ > inv_step_fact_ * params_.n_steps_equil) {
+    for (auto it = species_.begin(); it != species_.end(); ++it) {
+      (*it)->FinalizeAnalysis();
+    }
+  }
+}
+
 /* Post-processing on simulation outputs for movie generation, analysis output
  * generation, etc. */
 void Simulation::RunProcessing(run_options run_opts) {
   Logger::Info("Processing outputs for %s", run_name_.c_str());
+  if (run_opts.columns) {
+    output_mgr_.ExportColumns();
+    ix_mgr_.ExportColumns();
+    return;
+  }
+  if (frame_parallel_) {
+    RunFrameParallelAnalysis(run_opts);
+    return;
+  }
 
-  for (i_step_ = 1; i_step_ <= (params_.n_steps*inv_step_fact_); ++i_step_) {
+  for (i_step_ = frame_first_step_; i_step_ <= frame_last_step_;
+       i_step_ += frame_step_stride_) {
     params_.i_step = i_step_;
     time_ = params_.i_step * params_.delta * step_fact_;
     PrintComplete();
@@ -105,7 +105,7 @@ void SimulationManager::RunManager() {
     return;
   } else if (run_opts_.analysis_flag || run_opts_.make_movie ||
              run_opts_.graphics_flag || run_opts_.reduce_flag || 
-             run_opts_.convert) {
+             run_opts_.convert || run_opts_.columns) {
     // Process the output files associated with the param file
     ProcessOutputs();
   } else {
@@ -559,9 +559,21 @@ void SimulationManager::WriteParams() {
    a YAML::Node. Parse the parameters of that node using the
    parse_params function (that is generated automatically using
    cglass_config) and create (and delete) a new simulation using
-   those parameters.
+   those parameters. With more than one job, the simulations are instead
+   run concurrently in separate processes by a JobRunner.
    *************************************/
 void SimulationManager::RunSimulations() {
+  if (run_opts_.n_jobs > 1 && pfiles_.size() > 1) {
+    JobRunner runner;
+    runner.Init(run_opts_.exe_name, run_name_, run_opts_.n_jobs,
+                run_opts_.debug);
+    int n_failed = runner.Run(pfiles_);
+    if (n_failed > 0) {
+      Logger::Error("%d of %d simulations in batch %s did not complete",
+                    n_failed, (int)pfiles_.size(), run_name_.c_str());
+    }
+    return;
+  }
   for (std::vector<std::string>::iterator it = pfiles_.begin();
        it != pfiles_.end(); ++it) {
     // ParseParams(*it);
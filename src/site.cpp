@@ -130,23 +130,30 @@ bool Site::HasNeighbor(int other_oid) {
   return false;
 }
 
-void Site::WriteSpec(std::fstream& op) {
+void Site::WriteSpec(FrameBuffer &op) {
   for (int i = 0; i < 3; ++i)
-    op.write(reinterpret_cast<char*>(&position_[i]), sizeof(double));
+    op.write(reinterpret_cast<char*>(&position_[i]), sizeof(double),
+             field_length);
 }
 
 void Site::WriteSpecTextHeader(std::fstream &otext) {
   otext << "position[0] position[1] position[2]" << std::endl;
 }
 
-void Site::ConvertSpec(std::fstream &ispec, std::fstream &otext) {
+void Site::ConvertSpec(FrameReader &ispec, std::fstream &otext) {
   double position[3];
   for (int i = 0; i < 3; ++i)
     ispec.read(reinterpret_cast<char*>(&position[i]), sizeof(double));
   otext << position[0] << " " << position[1] << " " << position[2] << std::endl;
 }
 
-void Site::ReadSpec(std::fstream& ip) {
+void Site::ExportSpec(FrameReader &ispec, ColumnFrame &columns) {
+  double position[3];
+  ispec.read(reinterpret_cast<char *>(position), sizeof(position));
+  columns.Add("position", position, 3);
+}
+
+void Site::ReadSpec(FrameReader &ip) {
   for (int i = 0; i < 3; ++i)
     ip.read(reinterpret_cast<char*>(&position_[i]), sizeof(double));
 }
@@ -18,12 +18,8 @@ void SpeciesBase::InitPositFile(std::string run_name) {
   if (!oposit_file_.is_open()) {
     Logger::Error("Output file %s did not open", posit_file_name.c_str());
   }
-  int n_posit = GetNPosit();
-  int n_steps = params_->n_steps;
-  double delta = params_->delta;
-  oposit_file_.write(reinterpret_cast<char *>(&n_steps), sizeof(int));
-  oposit_file_.write(reinterpret_cast<char *>(&n_posit), sizeof(int));
-  oposit_file_.write(reinterpret_cast<char *>(&delta), sizeof(double));
+  WriteFileHeader(oposit_file_, posit_encoder_, GetNPosit(), posit_offset_);
+  OpenIndexFile(oposit_index_file_, posit_file_name + ".idx");
 }
 
 void SpeciesBase::InitPositFileInput(std::string run_name) {
@@ -34,6 +30,8 @@ void SpeciesBase::InitPositFileInput(std::string run_name) {
   if (!iposit_file_.is_open()) {
     Logger::Error("Input file %s did not open", posit_file_name.c_str());
   }
+  iposit_file_name_ = posit_file_name;
+  posit_indexed_ = ReadFrameIndex(posit_file_name + ".idx", posit_index_);
   // long n_steps;
   int n_posit, n_steps;
   double delta;
@@ -61,12 +59,93 @@ void SpeciesBase::InitSpecFile(std::string run_name) {
   if (!ospec_file_.is_open()) {
     Logger::Error("Output file %s did not open", spec_file_name.c_str());
   }
-  int n_spec = GetNSpec();
+  WriteFileHeader(ospec_file_, spec_encoder_, GetNSpec(), spec_offset_);
+  OpenIndexFile(ospec_index_file_, spec_file_name + ".idx");
+}
+
+/* Write the n_steps, n_posit/n_spec and delta header of an output file, set
+   offset to the offset of the first frame, and set up compact output */
+void SpeciesBase::WriteFileHeader(std::fstream &ofile,
+                                  TrajectoryEncoder &encoder, int n_out,
+                                  int64_t &offset) {
   int n_steps = params_->n_steps;
   double delta = params_->delta;
-  ospec_file_.write(reinterpret_cast<char *>(&n_steps), sizeof(int));
-  ospec_file_.write(reinterpret_cast<char *>(&n_spec), sizeof(int));
-  ospec_file_.write(reinterpret_cast<char *>(&delta), sizeof(double));
+  oframe_.Clear();
+  oframe_.write(reinterpret_cast<char *>(&n_steps), sizeof(int));
+  oframe_.write(reinterpret_cast<char *>(&n_out), sizeof(int));
+  oframe_.write(reinterpret_cast<char *>(&delta), sizeof(double));
+  if (params_->compact_output) {
+    double quantum = params_->compact_precision * params_->system_radius;
+    if (quantum <= 0) {
+      Logger::Error("Compact output requires positive compact_precision and "
+                    "system_radius");
+    }
+    encoder.Init(quantum, params_->compact_precision,
+                 params_->compact_keyframe_interval);
+    encoder.EncodeHeader(oframe_, oblock_);
+    oframe_.Clear();
+    oframe_.Swap(oblock_);
+    oframe_.RecordFields(true);
+  }
+  offset = oframe_.Size();
+  oframe_.Flush(ofile);
+}
+
+/* Replace the frame in oframe_, which starts at offset, with its compact
+   encoding if compact output is enabled */
+void SpeciesBase::CompressFrame(TrajectoryEncoder &encoder, int64_t offset) {
+  if (!encoder.IsEnabled()) {
+    return;
+  }
+  encoder.Encode(oframe_, offset, oblock_);
+  oframe_.Clear();
+  oframe_.Swap(oblock_);
+}
+
+void SpeciesBase::OpenIndexFile(std::fstream &oindex,
+                                std::string const &file_name) {
+  oindex.open(file_name, std::ios::out | std::ios::binary);
+  if (!oindex.is_open()) {
+    Logger::Warning("Frame index file %s did not open", file_name.c_str());
+  }
+}
+
+/* Record the frame in oframe_, which starts at offset, and advance offset
+   past it. Called before the frame is committed. */
+void SpeciesBase::IndexFrame(std::fstream &oindex, int64_t &offset,
+                             int n_members) {
+  if (oindex.is_open()) {
+    frame_index_entry entry;
+    entry.step = params_->i_step;
+    entry.offset = offset;
+    entry.n_members = n_members;
+    WriteFrameIndexEntry(oindex, entry);
+  }
+  offset += oframe_.Size();
+}
+
+/* Position ifile at the start of frame i_frame. Triggers an early exit if the
+   index has no such frame. */
+bool SpeciesBase::SeekFrame(FrameReader &ifile,
+                            std::vector<frame_index_entry> const &index,
+                            int i_frame) {
+  if (i_frame < 0 || i_frame >= (int)index.size()) {
+    Logger::Info("Last indexed frame reached for %s %s", sid_._to_string(),
+                 GetSpeciesName().c_str());
+    early_exit = true;
+    return false;
+  }
+  ifile.clear();
+  ifile.seekg(index[i_frame].offset);
+  return true;
+}
+
+bool SpeciesBase::SeekPositFrame(int i_frame) {
+  return SeekFrame(iposit_file_, posit_index_, i_frame);
+}
+
+bool SpeciesBase::SeekSpecFrame(int i_frame) {
+  return SeekFrame(ispec_file_, spec_index_, i_frame);
 }
 
 bool SpeciesBase::HandleEOF() {
@@ -124,6 +203,8 @@ bool SpeciesBase::InitSpecFileInputFromFile(std::string spec_file_name, bool con
   if (!ispec_file_.is_open()) {
     return false;
   }
+  ispec_file_name_ = spec_file_name;
+  spec_indexed_ = ReadFrameIndex(spec_file_name + ".idx", spec_index_);
   // long n_steps;
   int n_spec, n_steps;
   double delta;
@@ -189,6 +270,14 @@ void SpeciesBase::InitConvertFiles(std::string run_name) {
     InitConvertSpecFile(run_name);
 }
 
+/* Open the spec file to export it to columns, without reading any frames */
+void SpeciesBase::InitColumnFiles(std::string run_name) {
+  Logger::Trace("Initializing column export input files for %s %s",
+                sid_._to_string(), GetSpeciesName().c_str());
+  if (GetSpecFlag())
+    InitSpecFileInput(run_name, true);
+}
+
 void SpeciesBase::InitCheckpoints(std::string run_name) {
   std::string sid_str = sid_._to_string();
   checkpoint_file_ =
@@ -221,11 +310,35 @@ void SpeciesBase::InitInputFiles(std::string run_name, bool posits_only,
   }
 }
 
+/* Write the frame in oframe_ to ofile, or hand it to the output writer */
+void SpeciesBase::CommitFrame(std::fstream &ofile) {
+  if (writer_) {
+    writer_->Submit(oframe_, ofile);
+  } else {
+    oframe_.Flush(ofile);
+  }
+}
+
+/* Replace the contents of file_name with the frame in oframe_ */
+void SpeciesBase::CommitFrame(std::string const &file_name) {
+  if (writer_) {
+    writer_->Submit(oframe_, file_name);
+    return;
+  }
+  if (!oframe_.Replace(file_name)) {
+    Logger::Error("Output %s file could not be written", file_name.c_str());
+  }
+}
+
 void SpeciesBase::CloseFiles() {
   Logger::Trace("Closing output files for %s %s", sid_._to_string(),
                 GetSpeciesName().c_str());
   if (oposit_file_.is_open())
     oposit_file_.close();
+  if (oposit_index_file_.is_open())
+    oposit_index_file_.close();
+  if (ospec_index_file_.is_open())
+    ospec_index_file_.close();
   if (iposit_file_.is_open())
     iposit_file_.close();
   if (ospec_file_.is_open())
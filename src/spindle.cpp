@@ -6,7 +6,7 @@ Spindle::Spindle(unsigned long seed) : BrRod(seed) {
 
 void Spindle::SetParameters() {
   color_ = sparams_->color;
-  name_ = sparams_->name;
+  SetName(sparams_->name);
   draw_ = draw_type::_from_string(sparams_->draw_type.c_str());
   diameter_ = sparams_->diameter;
   length_ = sparams_->length;
@@ -283,21 +283,25 @@ const bool Spindle::CheckInteractorUpdate() {
   return Object::CheckInteractorUpdate();
 }
 
-void Spindle::WriteSpec(std::fstream &ospec) {
-  ospec.write(reinterpret_cast<char *>(&diameter_), sizeof(diameter_));
-  ospec.write(reinterpret_cast<char *>(&length_), sizeof(length_));
+void Spindle::WriteSpec(FrameBuffer &ospec) {
+  ospec.write(reinterpret_cast<char *>(&diameter_), sizeof(diameter_),
+              field_length);
+  ospec.write(reinterpret_cast<char *>(&length_), sizeof(length_),
+              field_length);
   for (int i = 0; i < 3; ++i) {
-    ospec.write(reinterpret_cast<char *>(&position_[i]), sizeof(double));
+    ospec.write(reinterpret_cast<char *>(&position_[i]), sizeof(double),
+                field_length);
   }
   for (int i = 0; i < 3; ++i) {
-    ospec.write(reinterpret_cast<char *>(&orientation_[i]), sizeof(double));
+    ospec.write(reinterpret_cast<char *>(&orientation_[i]), sizeof(double),
+                field_unit);
   }
   ospec.write(reinterpret_cast<char *>(&n_filaments_), sizeof(int));
   for (auto it = nuc_sites_.begin(); it != nuc_sites_.end(); ++it) {
     double theta = it->GetTheta();
     double phi = it->GetPhi();
-    ospec.write(reinterpret_cast<char *>(&theta), sizeof(double));
-    ospec.write(reinterpret_cast<char *>(&phi), sizeof(double));
+    ospec.write(reinterpret_cast<char *>(&theta), sizeof(double), field_unit);
+    ospec.write(reinterpret_cast<char *>(&phi), sizeof(double), field_unit);
   }
   for (int ifil = 0; ifil < n_filaments_; ++ifil) {
     filaments_[ifil].WriteSpec(ospec);
@@ -310,7 +314,7 @@ void Spindle::WriteSpecTextHeader(std::fstream &otext) {
         << "nfilaments" << std::endl;
 }
 
-void Spindle::ConvertSpec(std::fstream &ispec, std::fstream &otext) {
+void Spindle::ConvertSpec(FrameReader &ispec, std::fstream &otext) {
   if (ispec.eof())
     return;
   double diameter, length;
@@ -341,7 +345,41 @@ void Spindle::ConvertSpec(std::fstream &ispec, std::fstream &otext) {
   }
 }
 
-void Spindle::ReadSpec(std::fstream &ispec) {
+/* Nucleation sites and filaments go to the filament group, indexed by
+   filament_offsets */
+void Spindle::ExportSpec(FrameReader &ispec, ColumnFrame &columns) {
+  if (ispec.eof())
+    return;
+  double diameter, length;
+  double position[3], orientation[3];
+  int nfilaments;
+  ispec.read(reinterpret_cast<char *>(&diameter), sizeof(double));
+  ispec.read(reinterpret_cast<char *>(&length), sizeof(double));
+  ispec.read(reinterpret_cast<char *>(position), sizeof(position));
+  ispec.read(reinterpret_cast<char *>(orientation), sizeof(orientation));
+  ispec.read(reinterpret_cast<char *>(&nfilaments), sizeof(int));
+  if (ispec.eof())
+    return;
+  columns.Add("diameter", &diameter);
+  columns.Add("length", &length);
+  columns.Add("position", position, 3);
+  columns.Add("orientation", orientation, 3);
+  columns.AddCount("filament", nfilaments);
+  columns.BeginGroup("filament");
+  for (int i = 0; i < nfilaments && !ispec.eof(); ++i) {
+    double theta, phi;
+    ispec.read(reinterpret_cast<char *>(&theta), sizeof(double));
+    ispec.read(reinterpret_cast<char *>(&phi), sizeof(double));
+    columns.Add("theta", &theta);
+    columns.Add("phi", &phi);
+  }
+  for (int i = 0; i < nfilaments && !ispec.eof(); ++i) {
+    Filament::ExportSpec(ispec, columns);
+  }
+  columns.EndGroup();
+}
+
+void Spindle::ReadSpec(FrameReader &ispec) {
   if (ispec.eof())
     return;
   int nfilaments = 0;
@@ -397,7 +435,7 @@ void Spindle::ReadSpec(std::fstream &ispec) {
   }
 }
 
-void Spindle::WriteCheckpoint(std::fstream &ocheck) {
+void Spindle::WriteCheckpoint(FrameBuffer &ocheck) {
   Object::WriteCheckpoint(ocheck);
   for (auto it = nuc_sites_.begin(); it != nuc_sites_.end(); ++it) {
     it->WriteCheckpointHeader(ocheck);
@@ -408,7 +446,7 @@ void Spindle::WriteCheckpoint(std::fstream &ocheck) {
   }
 }
 
-void Spindle::ReadCheckpoint(std::fstream &icheck) {
+void Spindle::ReadCheckpoint(FrameReader &icheck) {
   Object::ReadCheckpoint(icheck);
   for (auto it = nuc_sites_.begin(); it != nuc_sites_.end(); ++it) {
     it->ReadCheckpointHeader(icheck);
@@ -78,7 +78,10 @@ void SpindleSpecies::ReadSpecs() {
   }
   if (n_members_ == 0) {
     members_.clear();
-  } else if (n_members_ != members_.size()) {
+  } else if (n_members_ < (int)members_.size()) {
+    members_.erase(members_.begin() + n_members_, members_.end());
+  } else if (n_members_ > (int)members_.size()) {
+    /* Only build a template member if new members are needed */
     Spindle s(rng_.GetSeed());
     s.Init(&sparams_);
     s.InitFilamentParameters(&fparams_);
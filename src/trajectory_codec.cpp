@@ -0,0 +1,431 @@
+#include "cglass/trajectory_codec.hpp"
+#include "cglass/logger.hpp"
+#include <cmath>
+#include <cstring>
+
+namespace {
+
+const char compact_magic[8] = {'C', 'G', 'L', 'S', 'C', 'M', 'P', '2'};
+const size_t file_header_size = 8 + 2 * sizeof(double) + sizeof(int);
+const size_t block_header_size =
+    1 + 2 * sizeof(uint32_t) + sizeof(int64_t);
+/* Quantized doubles beyond this many steps are stored exactly */
+const double max_quantized = 2.0e18;
+
+enum block_type { stored_block = 0, key_block = 1, delta_block = 2 };
+
+/* Symbol contexts: each varint byte position of a field type is coded with
+   its own adaptive model */
+enum symbol_context {
+  ctx_double = 0, // 3 contexts: first, second and later varint bytes
+  ctx_unit = 3,   // 3 contexts
+  ctx_exact = 6,  // 3 contexts
+  ctx_int = 9,    // 2 contexts
+  ctx_byte = 11,
+  ctx_raw = 12,
+  ctx_layout = 13,
+  n_contexts = 14
+};
+
+/* The layout records each field as its size and, for doubles, its kind */
+inline int FieldCode(int size, int kind) { return (size << 2) | kind; }
+inline int FieldSize(int code) { return code >> 2; }
+inline int FieldKind(int code) { return code & 3; }
+
+/* Each context holds adaptive binary models for the 8 bits of a byte, as a
+   binary tree of 256 probabilities. Models start over in every block. */
+uint16_t *ResetModels(std::vector<uint16_t> &models) {
+  models.assign(256 * n_contexts, 1024);
+  return &models[0];
+}
+
+/* Range coder with 11-bit adaptive bit probabilities, after LZMA */
+class RangeEncoder {
+private:
+  std::vector<char> &out_;
+  uint64_t low_ = 0;
+  uint32_t range_ = 0xFFFFFFFF;
+  unsigned char cache_ = 0;
+  uint64_t cache_size_ = 1;
+  void ShiftLow() {
+    if ((uint32_t)low_ < 0xFF000000u || (low_ >> 32) != 0) {
+      unsigned char carry = (unsigned char)(low_ >> 32);
+      unsigned char temp = cache_;
+      do {
+        out_.push_back((char)(unsigned char)(temp + carry));
+        temp = 0xFF;
+      } while (--cache_size_ != 0);
+      cache_ = (unsigned char)((uint32_t)low_ >> 24);
+    }
+    cache_size_++;
+    low_ = (uint32_t)low_ << 8;
+  }
+
+public:
+  RangeEncoder(std::vector<char> &out) : out_(out) {}
+  void EncodeBit(uint16_t &prob, int bit) {
+    uint32_t bound = (range_ >> 11) * prob;
+    if (bit == 0) {
+      range_ = bound;
+      prob += (2048 - prob) >> 5;
+    } else {
+      low_ += bound;
+      range_ -= bound;
+      prob -= prob >> 5;
+    }
+    while (range_ < (1u << 24)) {
+      range_ <<= 8;
+      ShiftLow();
+    }
+  }
+  void EncodeByte(uint16_t *probs, unsigned char byte) {
+    int node = 1;
+    for (int i = 7; i >= 0; --i) {
+      int bit = (byte >> i) & 1;
+      EncodeBit(probs[node], bit);
+      node = (node << 1) | bit;
+    }
+  }
+  void Flush() {
+    for (int i = 0; i < 5; ++i) {
+      ShiftLow();
+    }
+  }
+};
+
+class RangeDecoder {
+private:
+  const unsigned char *in_;
+  size_t size_;
+  size_t pos_ = 0;
+  uint32_t range_ = 0xFFFFFFFF;
+  uint32_t code_ = 0;
+  unsigned char Next() { return (pos_ < size_ ? in_[pos_++] : 0); }
+
+public:
+  RangeDecoder(const char *in, size_t size)
+      : in_(reinterpret_cast<const unsigned char *>(in)), size_(size) {
+    for (int i = 0; i < 5; ++i) {
+      code_ = (code_ << 8) | Next();
+    }
+  }
+  int DecodeBit(uint16_t &prob) {
+    uint32_t bound = (range_ >> 11) * prob;
+    int bit;
+    if (code_ < bound) {
+      range_ = bound;
+      prob += (2048 - prob) >> 5;
+      bit = 0;
+    } else {
+      code_ -= bound;
+      range_ -= bound;
+      prob -= prob >> 5;
+      bit = 1;
+    }
+    while (range_ < (1u << 24)) {
+      range_ <<= 8;
+      code_ = (code_ << 8) | Next();
+    }
+    return bit;
+  }
+  unsigned char DecodeByte(uint16_t *probs) {
+    int node = 1;
+    while (node < 256) {
+      node = (node << 1) | DecodeBit(probs[node]);
+    }
+    return (unsigned char)(node - 256);
+  }
+};
+
+inline uint64_t ZigZag(int64_t v) {
+  return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+inline int64_t UnZigZag(uint64_t v) {
+  return (int64_t)(v >> 1) ^ -(int64_t)(v & 1);
+}
+
+void EncodeVarint(RangeEncoder &rc, uint16_t *models, int ctx, int n_ctx,
+                  uint64_t v) {
+  int i = 0;
+  do {
+    unsigned char byte = v & 0x7F;
+    v >>= 7;
+    if (v) {
+      byte |= 0x80;
+    }
+    rc.EncodeByte(models + 256 * (ctx + (i < n_ctx ? i : n_ctx - 1)), byte);
+    ++i;
+  } while (v);
+}
+
+uint64_t DecodeVarint(RangeDecoder &rc, uint16_t *models, int ctx,
+                      int n_ctx) {
+  uint64_t v = 0;
+  int shift = 0;
+  unsigned char byte;
+  int i = 0;
+  do {
+    byte = rc.DecodeByte(models + 256 * (ctx + (i < n_ctx ? i : n_ctx - 1)));
+    if (shift < 64) {
+      v |= (uint64_t)(byte & 0x7F) << shift;
+    }
+    shift += 7;
+    ++i;
+  } while (byte & 0x80);
+  return v;
+}
+
+template <typename V> void Append(FrameBuffer &out, V value) {
+  out.write(reinterpret_cast<const char *>(&value), sizeof(V));
+}
+
+template <typename V> V Extract(const char *data) {
+  V value;
+  std::memcpy(&value, data, sizeof(V));
+  return value;
+}
+
+/* Quantized double, with an escape for values that do not fit */
+void EncodeQuantized(RangeEncoder &rc, uint16_t *models, int ctx,
+                     const char *field, double inv_quantum, int64_t &prev) {
+  double steps = Extract<double>(field) * inv_quantum;
+  if (std::isfinite(steps) && std::fabs(steps) < max_quantized) {
+    int64_t q = std::llround(steps);
+    EncodeVarint(rc, models, ctx, 3, ZigZag(q - prev) << 1);
+    prev = q;
+  } else {
+    /* Escape, followed by the exact value */
+    EncodeVarint(rc, models, ctx, 3, 1);
+    for (int j = 0; j < 8; ++j) {
+      rc.EncodeByte(models + 256 * (ctx_raw), field[j]);
+    }
+    prev = 0;
+  }
+}
+
+double DecodeQuantized(RangeDecoder &rc, uint16_t *models, int ctx,
+                       double quantum, int64_t &prev) {
+  uint64_t v = DecodeVarint(rc, models, ctx, 3);
+  if (v & 1) {
+    char raw[8];
+    for (int j = 0; j < 8; ++j) {
+      raw[j] = rc.DecodeByte(models + 256 * (ctx_raw));
+    }
+    prev = 0;
+    return Extract<double>(raw);
+  }
+  prev += UnZigZag(v >> 1);
+  return prev * quantum;
+}
+
+} // namespace
+
+void TrajectoryEncoder::Init(double quantum, double unit_quantum,
+                             int keyframe_interval) {
+  quantum_ = quantum;
+  inv_quantum_ = 1.0 / quantum;
+  unit_quantum_ = unit_quantum;
+  inv_unit_quantum_ = 1.0 / unit_quantum;
+  keyframe_interval_ = (keyframe_interval < 1 ? 1 : keyframe_interval);
+  since_keyframe_ = keyframe_interval_;
+  prev_layout_.clear();
+}
+
+void TrajectoryEncoder::WriteBlock(FrameBuffer &out, unsigned char type,
+                                   size_t decoded_size) {
+  Append<unsigned char>(out, type);
+  Append<uint32_t>(out, decoded_size);
+  Append<uint32_t>(out, payload_.size());
+  Append<int64_t>(out, keyframe_offset_);
+  if (!payload_.empty()) {
+    out.write(&payload_[0], payload_.size());
+  }
+}
+
+void TrajectoryEncoder::EncodeHeader(FrameBuffer &header, FrameBuffer &out) {
+  out.write(compact_magic, sizeof(compact_magic));
+  Append<double>(out, quantum_);
+  Append<double>(out, unit_quantum_);
+  Append<int>(out, keyframe_interval_);
+  payload_.assign(header.Data(), header.Data() + header.Size());
+  WriteBlock(out, stored_block, header.Size());
+}
+
+void TrajectoryEncoder::Encode(FrameBuffer &frame, int64_t offset,
+                               FrameBuffer &out) {
+  /* Arrays of lengths or unit values are split into doubles, and other
+     writes of unusual sizes are coded as individual bytes */
+  layout_.clear();
+  size_t n_bytes = 0;
+  for (auto const &f : frame.Fields()) {
+    if (f.size == 8) {
+      layout_.push_back(FieldCode(8, f.kind));
+    } else if (f.size == 1 || f.size == 4) {
+      layout_.push_back(FieldCode(f.size, field_exact));
+    } else if (f.size % 8 == 0 && f.kind != field_exact) {
+      layout_.insert(layout_.end(), f.size / 8, FieldCode(8, f.kind));
+    } else {
+      layout_.insert(layout_.end(), f.size, FieldCode(1, field_exact));
+    }
+    n_bytes += f.size;
+  }
+  if (n_bytes != frame.Size()) {
+    layout_.assign(frame.Size(), FieldCode(1, field_exact));
+  }
+  bool keyframe =
+      (since_keyframe_ >= keyframe_interval_ || layout_ != prev_layout_);
+  if (keyframe) {
+    since_keyframe_ = 0;
+    keyframe_offset_ = offset;
+    prev_.assign(layout_.size(), 0);
+  }
+  since_keyframe_++;
+
+  payload_.clear();
+  uint16_t *models = ResetModels(models_);
+  RangeEncoder rc(payload_);
+  if (keyframe) {
+    /* Run-length encoded field codes */
+    std::vector<std::pair<int, int>> runs;
+    for (auto n : layout_) {
+      if (runs.empty() || runs.back().first != n) {
+        runs.push_back(std::make_pair(n, 0));
+      }
+      runs.back().second++;
+    }
+    EncodeVarint(rc, models, ctx_layout, 1, runs.size());
+    for (auto it = runs.begin(); it != runs.end(); ++it) {
+      EncodeVarint(rc, models, ctx_layout, 1, it->first);
+      EncodeVarint(rc, models, ctx_layout, 1, it->second);
+    }
+  }
+  const char *field = frame.Data();
+  for (size_t i = 0; i < layout_.size(); ++i) {
+    int size = FieldSize(layout_[i]);
+    if (size == 8 && FieldKind(layout_[i]) == field_length) {
+      EncodeQuantized(rc, models, ctx_double, field, inv_quantum_, prev_[i]);
+    } else if (size == 8 && FieldKind(layout_[i]) == field_unit) {
+      EncodeQuantized(rc, models, ctx_unit, field, inv_unit_quantum_,
+                      prev_[i]);
+    } else if (size == 8) {
+      /* Exact doubles difference their bit patterns */
+      int64_t bits = Extract<int64_t>(field);
+      EncodeVarint(rc, models, ctx_exact, 3,
+                   ZigZag((int64_t)((uint64_t)bits - (uint64_t)prev_[i])));
+      prev_[i] = bits;
+    } else if (size == 4) {
+      int32_t v = Extract<int32_t>(field);
+      EncodeVarint(rc, models, ctx_int, 2, ZigZag(v - prev_[i]));
+      prev_[i] = v;
+    } else {
+      unsigned char v = field[0];
+      rc.EncodeByte(models + 256 * (ctx_byte), v ^ (unsigned char)prev_[i]);
+      prev_[i] = v;
+    }
+    field += size;
+  }
+  rc.Flush();
+  WriteBlock(out, keyframe ? key_block : delta_block, frame.Size());
+  prev_layout_.swap(layout_);
+}
+
+bool TrajectoryDecoder::IsCompact(const char *data, size_t size) {
+  return (size >= file_header_size &&
+          std::memcmp(data, compact_magic, sizeof(compact_magic)) == 0);
+}
+
+void TrajectoryDecoder::Init(const char *data) {
+  quantum_ = Extract<double>(data + sizeof(compact_magic));
+  unit_quantum_ =
+      Extract<double>(data + sizeof(compact_magic) + sizeof(double));
+  first_block_ = next_offset_ = file_header_size;
+  layout_.clear();
+  prev_.clear();
+}
+
+bool TrajectoryDecoder::Decode(const char *data, size_t size, size_t &pos,
+                               std::vector<char> &frame) {
+  if (pos + block_header_size > size) {
+    return false;
+  }
+  const char *header = data + pos;
+  unsigned char type = Extract<unsigned char>(header);
+  uint32_t decoded_size = Extract<uint32_t>(header + 1);
+  uint32_t encoded_size = Extract<uint32_t>(header + 1 + sizeof(uint32_t));
+  if (pos + block_header_size + encoded_size > size) {
+    return false;
+  }
+  const char *payload = header + block_header_size;
+  frame.resize(decoded_size);
+  if (type == stored_block) {
+    if (decoded_size > 0) {
+      std::memcpy(&frame[0], payload, decoded_size);
+    }
+  } else {
+    uint16_t *models = ResetModels(models_);
+    RangeDecoder rc(payload, encoded_size);
+    if (type == key_block) {
+      layout_.clear();
+      uint64_t n_runs = DecodeVarint(rc, models, ctx_layout, 1);
+      for (uint64_t i = 0; i < n_runs; ++i) {
+        int n = DecodeVarint(rc, models, ctx_layout, 1);
+        uint64_t count = DecodeVarint(rc, models, ctx_layout, 1);
+        layout_.insert(layout_.end(), count, n);
+      }
+      prev_.assign(layout_.size(), 0);
+    }
+    size_t n_bytes = 0;
+    for (auto code : layout_) {
+      n_bytes += FieldSize(code);
+    }
+    if (n_bytes != decoded_size || prev_.size() != layout_.size()) {
+      Logger::Warning("Corrupt frame found in compact output file");
+      return false;
+    }
+    char *field = (decoded_size > 0 ? &frame[0] : nullptr);
+    for (size_t i = 0; i < layout_.size(); ++i) {
+      int size = FieldSize(layout_[i]);
+      if (size == 8 && FieldKind(layout_[i]) == field_length) {
+        double x = DecodeQuantized(rc, models, ctx_double, quantum_, prev_[i]);
+        std::memcpy(field, &x, sizeof(double));
+      } else if (size == 8 && FieldKind(layout_[i]) == field_unit) {
+        double x =
+            DecodeQuantized(rc, models, ctx_unit, unit_quantum_, prev_[i]);
+        std::memcpy(field, &x, sizeof(double));
+      } else if (size == 8) {
+        uint64_t delta = UnZigZag(DecodeVarint(rc, models, ctx_exact, 3));
+        prev_[i] = (int64_t)((uint64_t)prev_[i] + delta);
+        std::memcpy(field, &prev_[i], sizeof(double));
+      } else if (size == 4) {
+        prev_[i] += UnZigZag(DecodeVarint(rc, models, ctx_int, 2));
+        int32_t v = (int32_t)prev_[i];
+        std::memcpy(field, &v, sizeof(int32_t));
+      } else {
+        unsigned char v = rc.DecodeByte(models + 256 * (ctx_byte)) ^
+                          (unsigned char)prev_[i];
+        field[0] = v;
+        prev_[i] = v;
+      }
+      field += size;
+    }
+  }
+  pos += block_header_size + encoded_size;
+  next_offset_ = pos;
+  return true;
+}
+
+bool TrajectoryDecoder::Seek(const char *data, size_t size, size_t offset) {
+  if (offset == next_offset_ || offset + block_header_size > size) {
+    return true;
+  }
+  if (Extract<unsigned char>(data + offset) != delta_block) {
+    return true;
+  }
+  size_t pos = Extract<int64_t>(data + offset + 1 + 2 * sizeof(uint32_t));
+  while (pos < offset) {
+    if (!Decode(data, size, pos, scratch_)) {
+      return false;
+    }
+  }
+  return (pos == offset);
+}
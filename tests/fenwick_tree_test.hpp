@@ -0,0 +1,93 @@
+#include <cglass/fenwick_tree.hpp>
+#include "catch.hpp"
+#include <cmath>
+#include <random>
+
+/* Smallest index whose cumulative weight exceeds roll, skipping zero
+   weights, or -1 if there is none */
+static int FindLinear(std::vector<double> const &weights, double roll) {
+  double sum = 0;
+  for (int i = 0; i < (int)weights.size(); ++i) {
+    sum += weights[i];
+    if (weights[i] > 0 && sum > roll) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+TEST_CASE("Fenwick tree draws indices by weight") {
+  FenwickTree tree;
+  SECTION("Draws follow cumulative weights") {
+    tree.Build({1, 0, 3, 2});
+    REQUIRE(tree.Size() == 4);
+    REQUIRE(tree.Total() == 6);
+    REQUIRE(tree.Find(0.0) == 0);
+    REQUIRE(tree.Find(0.5) == 0);
+    // Zero weights are never drawn
+    REQUIRE(tree.Find(1.0) == 2);
+    REQUIRE(tree.Find(3.5) == 2);
+    REQUIRE(tree.Find(4.0) == 3);
+    REQUIRE(tree.Find(5.5) == 3);
+    REQUIRE(tree.Find(6.0) == -1);
+  }
+  SECTION("Updates change totals and draws") {
+    tree.Build({1, 0, 3, 2});
+    tree.SetWeight(2, 0);
+    REQUIRE(tree.GetWeight(2) == 0);
+    REQUIRE(tree.Total() == 3);
+    REQUIRE(tree.Find(1.5) == 3);
+    tree.SetWeight(1, 4);
+    REQUIRE(tree.Total() == 7);
+    REQUIRE(tree.Find(1.5) == 1);
+    REQUIRE(tree.Find(5.5) == 3);
+  }
+  SECTION("Draws match a linear search after random updates") {
+    // Integer weights keep partial sums exact, and rolls avoid ties
+    std::mt19937 gen(314159);
+    std::vector<double> weights(37);
+    for (auto &w : weights) {
+      w = gen() % 5;
+    }
+    tree.Build(weights);
+    for (int i_update = 0; i_update < 200; ++i_update) {
+      int i = gen() % weights.size();
+      weights[i] = gen() % 5;
+      tree.SetWeight(i, weights[i]);
+      double total = 0;
+      for (auto w : weights) {
+        total += w;
+      }
+      REQUIRE(tree.Total() == total);
+      for (int i_roll = 0; i_roll < 10; ++i_roll) {
+        double roll = (gen() % (int)(total + 1)) + 0.5;
+        REQUIRE(tree.Find(roll) == FindLinear(weights, roll));
+      }
+    }
+  }
+  SECTION("Sampling frequencies are proportional to weights") {
+    std::vector<double> weights = {0.5, 2, 0, 1.5, 4};
+    tree.Build(weights);
+    std::mt19937 gen(2718);
+    std::uniform_real_distribution<double> uniform(0, tree.Total());
+    std::vector<int> counts(weights.size(), 0);
+    int n_draws = 80000;
+    for (int i = 0; i < n_draws; ++i) {
+      counts[tree.Find(uniform(gen))]++;
+    }
+    REQUIRE(counts[2] == 0);
+    for (int i = 0; i < (int)weights.size(); ++i) {
+      double expected = n_draws * weights[i] / 8.0;
+      // Five standard deviations of a binomial count
+      double sigma = sqrt(expected * (1 - weights[i] / 8.0));
+      REQUIRE(fabs(counts[i] - expected) <= 5 * sigma);
+    }
+  }
+  SECTION("Cleared trees have no weights to draw") {
+    tree.Build({1, 2});
+    tree.Clear();
+    REQUIRE(tree.Size() == 0);
+    REQUIRE(tree.Total() == 0);
+    REQUIRE(tree.Find(0.0) == -1);
+  }
+}
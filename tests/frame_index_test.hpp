@@ -0,0 +1,112 @@
+#include <cglass/frame_index.hpp>
+#include <cglass/simulation_manager.hpp>
+#include "catch.hpp"
+
+/* Mimic the RunProcessing loop: each visited step processes the loaded frame,
+   then reads frame i_step / n_frame_steps */
+static void VisitFrameSteps(frame_steps const &steps, int n_frame_steps,
+                            std::vector<int> &visited,
+                            std::vector<int> &processed) {
+  int loaded = steps.initial_step / n_frame_steps;
+  for (int i_step = steps.first_step; i_step <= steps.last_step;
+       i_step += steps.step_stride) {
+    visited.push_back(i_step);
+    processed.push_back(loaded);
+    loaded = i_step / n_frame_steps;
+  }
+}
+
+TEST_CASE("Frame ranges visit the steps of the selected frames") {
+  int n_frame_steps = 10;
+  int last_step = 1000;
+  std::vector<int> visited, processed;
+  SECTION("Range from frame 0 with stride") {
+    // --frames 0:10:3
+    frame_steps steps = GetFrameSteps(0, 10, 3, n_frame_steps, last_step);
+    VisitFrameSteps(steps, n_frame_steps, visited, processed);
+    REQUIRE(steps.initial_step == 0);
+    REQUIRE(visited == std::vector<int>({30, 60, 90, 120}));
+    REQUIRE(processed == std::vector<int>({0, 3, 6, 9}));
+  }
+  SECTION("Range from a later frame with unit stride") {
+    // --frames 2:6:1
+    frame_steps steps = GetFrameSteps(2, 6, 1, n_frame_steps, last_step);
+    VisitFrameSteps(steps, n_frame_steps, visited, processed);
+    REQUIRE(steps.initial_step == 20);
+    REQUIRE(visited == std::vector<int>({30, 40, 50, 60}));
+    REQUIRE(processed == std::vector<int>({2, 3, 4, 5}));
+  }
+  SECTION("Range with an empty stop ends with the run") {
+    // --frames 0::2 on a run of 100 steps
+    frame_steps steps = GetFrameSteps(0, -1, 2, n_frame_steps, 100);
+    VisitFrameSteps(steps, n_frame_steps, visited, processed);
+    REQUIRE(visited == std::vector<int>({20, 40, 60, 80, 100}));
+    REQUIRE(processed == std::vector<int>({0, 2, 4, 6, 8}));
+  }
+  SECTION("Unit stride from frame 0 matches sequential processing") {
+    frame_steps steps = GetFrameSteps(0, -1, 1, n_frame_steps, 50);
+    VisitFrameSteps(steps, n_frame_steps, visited, processed);
+    REQUIRE(visited == std::vector<int>({10, 20, 30, 40, 50}));
+    REQUIRE(processed == std::vector<int>({0, 1, 2, 3, 4}));
+  }
+}
+
+/* Run a short simulation that writes br_bead specs and posits, written either
+   on the simulation thread or by the async output writer */
+static void RunIndexedOutput(std::string const &run_name, bool async) {
+  std::string fname = run_name + "_params.yaml";
+  std::ofstream(fname, std::ios::out)
+      << "{run_name: " << run_name << ","
+      << " seed: 314159,"
+      << " n_steps: 100,"
+      << " n_dim: 3,"
+      << " n_periodic: 3,"
+      << " system_radius: 10,"
+      << " potential: none,"
+      << " async_output: " << (async ? "true" : "false") << ","
+      << " br_bead: {num: 20, spec_flag: true, n_spec: 10,"
+      << " posit_flag: true, n_posit: 10}}";
+  run_options run_opts;
+  run_opts.param_file = fname;
+  SimulationManager mgr;
+  mgr.InitManager(run_opts);
+  mgr.RunManager();
+}
+
+/* Check that each index entry points at the member count of its frame */
+static void RequireIndexedFrames(std::string const &file_name,
+                                 std::vector<frame_index_entry> &index) {
+  REQUIRE(ReadFrameIndex(file_name + ".idx", index));
+  REQUIRE(!index.empty());
+  std::fstream in(file_name, std::ios::in | std::ios::binary);
+  REQUIRE(in.is_open());
+  // Frames follow the n_steps, n_posit or n_spec, and delta file header
+  REQUIRE(index[0].offset == 2 * sizeof(int) + sizeof(double));
+  for (size_t i = 0; i < index.size(); ++i) {
+    if (i > 0) {
+      REQUIRE(index[i].step > index[i - 1].step);
+      REQUIRE(index[i].offset > index[i - 1].offset);
+    }
+    in.seekg(index[i].offset);
+    int n_members = -1;
+    in.read(reinterpret_cast<char *>(&n_members), sizeof(int));
+    REQUIRE(n_members == index[i].n_members);
+    REQUIRE(n_members == 20);
+  }
+}
+
+TEST_CASE("Frame index offsets are the same with and without async output") {
+  RunIndexedOutput("idx_sync", false);
+  RunIndexedOutput("idx_async", true);
+  for (std::string ext : {".spec", ".posit"}) {
+    std::vector<frame_index_entry> sync_index, async_index;
+    RequireIndexedFrames("idx_sync_br_bead_species" + ext, sync_index);
+    RequireIndexedFrames("idx_async_br_bead_species" + ext, async_index);
+    REQUIRE(sync_index.size() == async_index.size());
+    for (size_t i = 0; i < sync_index.size(); ++i) {
+      REQUIRE(sync_index[i].step == async_index[i].step);
+      REQUIRE(sync_index[i].offset == async_index[i].offset);
+      REQUIRE(sync_index[i].n_members == async_index[i].n_members);
+    }
+  }
+}
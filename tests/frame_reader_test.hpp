@@ -0,0 +1,80 @@
+#include <cglass/frame_reader.hpp>
+#include "catch.hpp"
+#include <fstream>
+
+/* FrameReader replaces std::fstream for reading outputs, so it has to leave
+   readers in the same state as the stream at the end of a file */
+TEST_CASE("FrameReader reads like std::fstream") {
+  std::string file_name = "frame_reader_test.bin";
+  int values[5] = {1, 2, 3, 4, 5};
+  std::ofstream(file_name, std::ios::out | std::ios::binary)
+      .write(reinterpret_cast<char *>(values), sizeof(values));
+  FrameReader reader;
+  reader.open(file_name);
+  std::fstream stream(file_name, std::ios::in | std::ios::binary);
+  REQUIRE(reader.is_open());
+  REQUIRE(reader.Size() == sizeof(values));
+  SECTION("Reads up to the end of the file") {
+    for (int i = 0; i < 5; ++i) {
+      int from_reader = -1, from_stream = -1;
+      reader.read(reinterpret_cast<char *>(&from_reader), sizeof(int));
+      stream.read(reinterpret_cast<char *>(&from_stream), sizeof(int));
+      REQUIRE(from_reader == values[i]);
+      REQUIRE(from_stream == values[i]);
+      REQUIRE(reader.tellg() == stream.tellg());
+    }
+    // Reading exactly to the end does not set eof
+    REQUIRE(!reader.eof());
+    REQUIRE(!stream.eof());
+    int from_reader = -1, from_stream = -1;
+    reader.read(reinterpret_cast<char *>(&from_reader), sizeof(int));
+    stream.read(reinterpret_cast<char *>(&from_stream), sizeof(int));
+    REQUIRE(reader.eof());
+    REQUIRE(stream.eof());
+    REQUIRE(from_reader == -1);
+    REQUIRE(from_stream == -1);
+  }
+  SECTION("Partial reads copy what remains") {
+    int skip[3];
+    reader.read(reinterpret_cast<char *>(skip), sizeof(skip));
+    stream.read(reinterpret_cast<char *>(skip), sizeof(skip));
+    int from_reader[4] = {-1, -1, -1, -1};
+    int from_stream[4] = {-1, -1, -1, -1};
+    reader.read(reinterpret_cast<char *>(from_reader), sizeof(from_reader));
+    stream.read(reinterpret_cast<char *>(from_stream), sizeof(from_stream));
+    REQUIRE(reader.eof());
+    REQUIRE(stream.eof());
+    REQUIRE(stream.gcount() == 2 * sizeof(int));
+    for (int i = 0; i < 4; ++i) {
+      REQUIRE(from_reader[i] == from_stream[i]);
+    }
+    REQUIRE(from_reader[1] == 5);
+    REQUIRE(from_reader[2] == -1);
+  }
+  SECTION("Clearing eof allows seeking back") {
+    char rest[32];
+    reader.read(rest, sizeof(rest));
+    stream.read(rest, sizeof(rest));
+    REQUIRE(reader.eof());
+    REQUIRE(stream.eof());
+    reader.clear();
+    stream.clear();
+    reader.seekg(sizeof(int));
+    stream.seekg(sizeof(int));
+    int from_reader = -1, from_stream = -1;
+    reader.read(reinterpret_cast<char *>(&from_reader), sizeof(int));
+    stream.read(reinterpret_cast<char *>(&from_stream), sizeof(int));
+    REQUIRE(!reader.eof());
+    REQUIRE(!stream.eof());
+    REQUIRE(from_reader == 2);
+    REQUIRE(from_stream == 2);
+  }
+  SECTION("Missing files are not opened") {
+    reader.open("frame_reader_test_missing.bin");
+    stream.close();
+    stream.open("frame_reader_test_missing.bin",
+                std::ios::in | std::ios::binary);
+    REQUIRE(!reader.is_open());
+    REQUIRE(!stream.is_open());
+  }
+}
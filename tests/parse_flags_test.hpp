@@ -0,0 +1,40 @@
+#include <cglass/parse_flags.hpp>
+#include "catch.hpp"
+
+TEST_CASE("Frame ranges are parsed from --frames") {
+  run_options run_opts;
+  SECTION("Start, stop and stride") {
+    REQUIRE(parse_frame_range("2:10:3", run_opts));
+    REQUIRE(run_opts.frame_start == 2);
+    REQUIRE(run_opts.frame_stop == 10);
+    REQUIRE(run_opts.frame_stride == 3);
+  }
+  SECTION("Start only") {
+    REQUIRE(parse_frame_range("5", run_opts));
+    REQUIRE(run_opts.frame_start == 5);
+    REQUIRE(run_opts.frame_stop == -1);
+    REQUIRE(run_opts.frame_stride == 1);
+  }
+  SECTION("Empty fields keep their defaults") {
+    REQUIRE(parse_frame_range("::4", run_opts));
+    REQUIRE(run_opts.frame_start == 0);
+    REQUIRE(run_opts.frame_stop == -1);
+    REQUIRE(run_opts.frame_stride == 4);
+  }
+  SECTION("Empty stop") {
+    REQUIRE(parse_frame_range("3:", run_opts));
+    REQUIRE(run_opts.frame_start == 3);
+    REQUIRE(run_opts.frame_stop == -1);
+    REQUIRE(run_opts.frame_stride == 1);
+  }
+  SECTION("Stop only") {
+    REQUIRE(parse_frame_range(":7", run_opts));
+    REQUIRE(run_opts.frame_start == 0);
+    REQUIRE(run_opts.frame_stop == 7);
+  }
+  SECTION("Invalid ranges") {
+    REQUIRE(!parse_frame_range("1:2:3:4", run_opts));
+    REQUIRE(!parse_frame_range("0:5:0", run_opts));
+    REQUIRE(!parse_frame_range("-1:5", run_opts));
+  }
+}
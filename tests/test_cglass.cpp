@@ -4,4 +4,9 @@
 #define TESTS
 #endif
 
-#include "simulation_manager_test.hpp"
\ No newline at end of file
+#include "simulation_manager_test.hpp"
+#include "frame_index_test.hpp"
+#include "trajectory_codec_test.hpp"
+#include "fenwick_tree_test.hpp"
+#include "frame_reader_test.hpp"
+#include "parse_flags_test.hpp"
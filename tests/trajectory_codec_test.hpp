@@ -0,0 +1,191 @@
+#include <cglass/frame_reader.hpp>
+#include <cglass/trajectory_codec.hpp>
+#include "catch.hpp"
+#include <cmath>
+#include <fstream>
+#include <limits>
+
+/* One member of a test frame, written the way object writers write theirs */
+struct codec_test_member {
+  double position[3];
+  double orientation[3];
+  double stiffness; // written without a kind, so stored exactly
+  int n_bonds;
+  bool bound;
+};
+
+typedef std::vector<codec_test_member> codec_test_frame;
+
+static codec_test_frame MakeCodecFrame(int i_frame, int n_members) {
+  codec_test_frame frame(n_members);
+  for (int i = 0; i < n_members; ++i) {
+    codec_test_member &m = frame[i];
+    double t = 0.37 * i_frame + 1.3 * i;
+    m.position[0] = 12.5 * std::cos(t) + 0.0123 * i_frame;
+    m.position[1] = -7.25 * std::sin(t);
+    m.position[2] = 0.001 * i;
+    m.orientation[0] = std::cos(t) * std::sin(0.5 * t);
+    m.orientation[1] = std::sin(t) * std::sin(0.5 * t);
+    m.orientation[2] = std::cos(0.5 * t);
+    m.stiffness = 1.0 / 3.0 + 1e-9 * i_frame;
+    m.n_bonds = 10 + i - i_frame;
+    m.bound = ((i + i_frame) % 2 == 0);
+  }
+  return frame;
+}
+
+static void WriteCodecFrame(codec_test_frame const &members,
+                            FrameBuffer &frame) {
+  int size = members.size();
+  frame.write(reinterpret_cast<const char *>(&size), sizeof(int));
+  for (auto const &m : members) {
+    frame.write(reinterpret_cast<const char *>(m.position),
+                3 * sizeof(double), field_length);
+    for (int i = 0; i < 3; ++i) {
+      frame.write(reinterpret_cast<const char *>(&m.orientation[i]),
+                  sizeof(double), field_unit);
+    }
+    frame.write(reinterpret_cast<const char *>(&m.stiffness), sizeof(double));
+    frame.write(reinterpret_cast<const char *>(&m.n_bonds), sizeof(int));
+    frame.write(reinterpret_cast<const char *>(&m.bound), sizeof(bool));
+  }
+}
+
+static codec_test_frame ReadCodecFrame(FrameReader &in) {
+  int size = 0;
+  in.read(reinterpret_cast<char *>(&size), sizeof(int));
+  codec_test_frame members(in.eof() ? 0 : size);
+  for (auto &m : members) {
+    in.read(reinterpret_cast<char *>(m.position), 3 * sizeof(double));
+    in.read(reinterpret_cast<char *>(m.orientation), 3 * sizeof(double));
+    in.read(reinterpret_cast<char *>(&m.stiffness), sizeof(double));
+    in.read(reinterpret_cast<char *>(&m.n_bonds), sizeof(int));
+    in.read(reinterpret_cast<char *>(&m.bound), sizeof(bool));
+  }
+  return members;
+}
+
+/* Write frames to a compact file as species do, returning frame offsets */
+static std::vector<int64_t>
+WriteCompactFile(std::string const &file_name,
+                 std::vector<codec_test_frame> const &frames, double quantum,
+                 double unit_quantum, int keyframe_interval) {
+  TrajectoryEncoder encoder;
+  encoder.Init(quantum, unit_quantum, keyframe_interval);
+  FrameBuffer header, file, frame;
+  int n_frames = frames.size();
+  header.write(reinterpret_cast<const char *>(&n_frames), sizeof(int));
+  encoder.EncodeHeader(header, file);
+  frame.RecordFields(true);
+  std::vector<int64_t> offsets;
+  for (auto const &members : frames) {
+    frame.Clear();
+    WriteCodecFrame(members, frame);
+    offsets.push_back(file.Size());
+    encoder.Encode(frame, file.Size(), file);
+  }
+  std::fstream out(file_name, std::ios::out | std::ios::binary);
+  file.Flush(out);
+  return offsets;
+}
+
+/* Check that a decoded value matches a written one to within half a
+   quantization step, or exactly if it could not be quantized */
+static void RequireDecoded(double written, double decoded, double quantum) {
+  if (std::isnan(written)) {
+    REQUIRE(std::isnan(decoded));
+  } else if (!std::isfinite(written) || std::fabs(written) > 1e100) {
+    REQUIRE(decoded == written);
+  } else {
+    REQUIRE(std::fabs(decoded - written) <= 0.5 * quantum * (1 + 1e-9));
+  }
+}
+
+static void RequireDecodedFrame(codec_test_frame const &written,
+                                codec_test_frame const &decoded,
+                                double quantum, double unit_quantum) {
+  REQUIRE(decoded.size() == written.size());
+  for (size_t i = 0; i < written.size(); ++i) {
+    for (int j = 0; j < 3; ++j) {
+      RequireDecoded(written[i].position[j], decoded[i].position[j], quantum);
+      RequireDecoded(written[i].orientation[j], decoded[i].orientation[j],
+                     unit_quantum);
+    }
+    REQUIRE(std::memcmp(&decoded[i].stiffness, &written[i].stiffness,
+                        sizeof(double)) == 0);
+    REQUIRE(decoded[i].n_bonds == written[i].n_bonds);
+    REQUIRE(decoded[i].bound == written[i].bound);
+  }
+}
+
+TEST_CASE("Compact output round-trips frames") {
+  std::string file_name = "codec_test.posit";
+  // Length step much coarser than the unit step, as in a large system
+  double quantum = 1e-2;
+  double unit_quantum = 1e-5;
+  std::vector<codec_test_frame> frames;
+  for (int i = 0; i < 12; ++i) {
+    frames.push_back(MakeCodecFrame(i, 5));
+  }
+  SECTION("Keyframes only") {
+    WriteCompactFile(file_name, frames, quantum, unit_quantum, 1);
+  }
+  SECTION("Delta frames") {
+    WriteCompactFile(file_name, frames, quantum, unit_quantum, 100);
+  }
+  SECTION("Escaped values") {
+    double inf = std::numeric_limits<double>::infinity();
+    frames[3][1].position[0] = std::nan("");
+    frames[4][1].position[0] = inf;
+    frames[4][2].orientation[1] = -inf;
+    frames[5][0].position[2] = 1e300;
+    frames[6][0].stiffness = std::nan("");
+    WriteCompactFile(file_name, frames, quantum, unit_quantum, 100);
+  }
+  SECTION("Layout changes") {
+    frames[4] = MakeCodecFrame(4, 7);
+    frames[5] = MakeCodecFrame(5, 7);
+    frames[8] = MakeCodecFrame(8, 0);
+    WriteCompactFile(file_name, frames, quantum, unit_quantum, 100);
+  }
+  FrameReader in;
+  in.open(file_name);
+  REQUIRE(in.is_open());
+  int n_frames = 0;
+  in.read(reinterpret_cast<char *>(&n_frames), sizeof(int));
+  REQUIRE(n_frames == (int)frames.size());
+  for (auto const &written : frames) {
+    RequireDecodedFrame(written, ReadCodecFrame(in), quantum, unit_quantum);
+  }
+  REQUIRE(!in.eof());
+  int extra;
+  in.read(reinterpret_cast<char *>(&extra), sizeof(int));
+  REQUIRE(in.eof());
+}
+
+TEST_CASE("Compact output seeks to delta frames") {
+  std::string file_name = "codec_seek_test.posit";
+  double quantum = 1e-3;
+  double unit_quantum = 1e-4;
+  std::vector<codec_test_frame> frames;
+  for (int i = 0; i < 10; ++i) {
+    frames.push_back(MakeCodecFrame(i, 3));
+  }
+  std::vector<int64_t> offsets =
+      WriteCompactFile(file_name, frames, quantum, unit_quantum, 4);
+  FrameReader in;
+  in.open(file_name);
+  REQUIRE(in.is_open());
+  // Frame 6 is the third delta frame after the keyframe at frame 4
+  in.seekg(offsets[6]);
+  RequireDecodedFrame(frames[6], ReadCodecFrame(in), quantum, unit_quantum);
+  RequireDecodedFrame(frames[7], ReadCodecFrame(in), quantum, unit_quantum);
+  // Seeking back to an earlier delta frame decodes from its keyframe
+  in.seekg(offsets[1]);
+  RequireDecodedFrame(frames[1], ReadCodecFrame(in), quantum, unit_quantum);
+  // Seeking to the frame that follows needs no decoding from the keyframe
+  in.seekg(offsets[2]);
+  RequireDecodedFrame(frames[2], ReadCodecFrame(in), quantum, unit_quantum);
+  in.seekg(offsets[9]);
+  RequireDecodedFrame(frames[9], ReadCodecFrame(in), quantum, unit_quantum);
+}